@@ -0,0 +1,607 @@
+/** Implements the runtime micro-benchmarks.
+ *
+ * Measures the fxx::tuple functors against equivalent std::apply and hand-written code, on 4-tuples
+ * of trivial, non-trivial and instrumented element types. For the instrumented types (counted and
+ * move_only), the average number of element copies and moves per iteration is reported as well.
+ *
+ * The tree-shaped reductions (reduce_tree and fold_tree) are measured separately against their
+ * linear counterparts, on wide homogeneous tuples of 16 to 64 elements. There, the balanced tree
+ * shortens the dependency chain of operations that the compiler may not reassociate (e.g. double
+ * sums), while it should make no difference for those it may (e.g. bitwise OR on integers).
+ *
+ * The same source is built once per optimization level (fxx-bench-O0, fxx-bench-O2 and
+ * fxx-bench-O3), which shows whether the functors are zero-overhead in release builds, and how
+ * much they cost in debug builds.
+ *
+ * @file        bench.cpp
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <fxx/meta/tuple.h>
+#include <fxx/tuple/dup.h>
+#include <fxx/tuple/find.h>
+#include <fxx/tuple/first.h>
+#include <fxx/tuple/flip.h>
+#include <fxx/tuple/fold.h>
+#include <fxx/tuple/fold_tree.h>
+#include <fxx/tuple/map.h>
+#include <fxx/tuple/pick.h>
+#include <fxx/tuple/reduce.h>
+#include <fxx/tuple/reduce_tree.h>
+#include <fxx/tuple/slice.h>
+
+#include <functional>
+// std::(bit_or, plus)
+#include <memory>
+// std::(make_unique, unique_ptr)
+#include <optional>
+// std::optional
+#include <string>
+// std::(string, to_string)
+#include <tuple>
+// std::(apply, get, make_tuple, tuple, tuple_element_t)
+#include <type_traits>
+// std::(decay_t, is_copy_constructible_v)
+#include <utility>
+// std::(forward, index_sequence, make_index_sequence, move)
+
+#include <cstddef>
+// std::size_t
+
+namespace {
+
+// Copy and move counts of the instrumented element types.
+struct counters {
+    static inline std::size_t copies = 0;
+    static inline std::size_t moves = 0;
+
+    static void reset() {
+        copies = 0;
+        moves = 0;
+    }
+};
+
+// Copyable element type that counts how often it was copied or moved.
+struct counted {
+    int value;
+
+    explicit counted(int value) : value(value) {}
+    counted(const counted& other) : value(other.value) { ++counters::copies; }
+    counted(counted&& other) noexcept : value(other.value) { ++counters::moves; }
+
+    counted& operator=(const counted& other) {
+        value = other.value;
+        ++counters::copies;
+        return *this;
+    }
+    counted& operator=(counted&& other) noexcept {
+        value = other.value;
+        ++counters::moves;
+        return *this;
+    }
+
+    friend bool operator==(const counted& lhs, const counted& rhs) {
+        return lhs.value == rhs.value;
+    }
+};
+
+// Move-only element type that counts how often it was moved.
+struct move_only {
+    std::unique_ptr<int> value;
+
+    explicit move_only(int value) : value(std::make_unique<int>(value)) {}
+    move_only(const move_only&) = delete;
+    move_only(move_only&& other) noexcept : value(std::move(other.value)) { ++counters::moves; }
+
+    move_only& operator=(const move_only&) = delete;
+    move_only& operator=(move_only&& other) noexcept {
+        value = std::move(other.value);
+        ++counters::moves;
+        return *this;
+    }
+
+    friend bool operator==(const move_only& lhs, const move_only& rhs) {
+        return lhs.value && rhs.value ? *lhs.value == *rhs.value : lhs.value == rhs.value;
+    }
+};
+
+// Element type traits: construction from an index, benchmark name and a scalar weight.
+template<class T>
+struct element;
+
+template<>
+struct element<int> {
+    static constexpr const char* name = "int";
+    static constexpr bool instrumented = false;
+    static int make(int i) { return i; }
+    static std::size_t weight(int x) { return static_cast<std::size_t>(x); }
+};
+
+template<>
+struct element<double> {
+    static constexpr const char* name = "double";
+    static constexpr bool instrumented = false;
+    static double make(int i) { return i + 0.5; }
+    static std::size_t weight(double x) { return static_cast<std::size_t>(x); }
+};
+
+template<>
+struct element<std::string> {
+    static constexpr const char* name = "string";
+    static constexpr bool instrumented = false;
+    // Long enough to defeat the small string optimization.
+    static std::string make(int i) { return std::string(32 + i, 'x'); }
+    static std::size_t weight(const std::string& x) { return x.size(); }
+};
+
+template<>
+struct element<counted> {
+    static constexpr const char* name = "counted";
+    static constexpr bool instrumented = true;
+    static counted make(int i) { return counted{i}; }
+    static std::size_t weight(const counted& x) { return static_cast<std::size_t>(x.value); }
+};
+
+template<>
+struct element<move_only> {
+    static constexpr const char* name = "move_only";
+    static constexpr bool instrumented = true;
+    static move_only make(int i) { return move_only{i}; }
+    // Moved-from elements weigh nothing, since move_only benchmarks repeatedly move their input.
+    static std::size_t weight(const move_only& x) {
+        return x.value ? static_cast<std::size_t>(*x.value) : 0;
+    }
+};
+
+template<class T>
+using tuple4 = std::tuple<T, T, T, T>;
+
+template<class Tuple>
+using element_t = std::decay_t<std::tuple_element_t<0, std::decay_t<Tuple>>>;
+
+template<class T>
+std::size_t weight(const T& x) {
+    return element<T>::weight(x);
+}
+
+// Source of the element-producing benchmarks: copied from when possible, moved from otherwise.
+template<class Tuple>
+decltype(auto) input(Tuple& tuple) {
+    if constexpr (std::is_copy_constructible_v<Tuple>) {
+        return (tuple);
+    } else {
+        return std::move(tuple);
+    }
+}
+
+// Identity that produces a new element from its argument.
+struct identity {
+    template<class T>
+    std::decay_t<T> operator()(T&& x) const {
+        return std::forward<T>(x);
+    }
+};
+
+// Keeps the heavier of two elements.
+struct heavier {
+    template<class T, class U>
+    T operator()(T acc, U&& x) const {
+        if (weight(x) > weight(acc)) {
+            return std::forward<U>(x);
+        }
+        return acc;
+    }
+};
+
+// Benchmark variants.
+struct fxx_t { static constexpr const char* name = "fxx"; };
+struct apply_t { static constexpr const char* name = "apply"; };
+struct hand_t { static constexpr const char* name = "hand"; };
+
+#define FXX_BENCH_FWD(x) std::forward<decltype(x)>(x)
+
+struct map_op {
+    static constexpr const char* name = "map";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static auto run(fxx_t, Tuple&& t) {
+        return fxx::tuple::map(identity{}, std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(apply_t, Tuple&& t) {
+        return std::apply([](auto&&... xs) {
+            return std::make_tuple(identity{}(FXX_BENCH_FWD(xs))...);
+        }, std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(hand_t, Tuple&& t) {
+        return std::make_tuple(
+            identity{}(std::get<0>(std::forward<Tuple>(t))),
+            identity{}(std::get<1>(std::forward<Tuple>(t))),
+            identity{}(std::get<2>(std::forward<Tuple>(t))),
+            identity{}(std::get<3>(std::forward<Tuple>(t)))
+        );
+    }
+};
+
+struct fold_op {
+    static constexpr const char* name = "fold";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static std::size_t run(fxx_t, const Tuple& t) {
+        return fxx::tuple::fold(
+            [](std::size_t acc, const auto& x) { return acc + weight(x); },
+            std::size_t{0},
+            t
+        );
+    }
+    template<class Tuple>
+    static std::size_t run(apply_t, const Tuple& t) {
+        return std::apply([](const auto&... xs) { return (std::size_t{0} + ... + weight(xs)); }, t);
+    }
+    template<class Tuple>
+    static std::size_t run(hand_t, const Tuple& t) {
+        return weight(std::get<0>(t))
+            + weight(std::get<1>(t))
+            + weight(std::get<2>(t))
+            + weight(std::get<3>(t));
+    }
+};
+
+struct reduce_op {
+    static constexpr const char* name = "reduce";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static auto run(fxx_t, Tuple&& t) {
+        return fxx::tuple::reduce(heavier{}, std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(apply_t, Tuple&& t) {
+        return std::apply([](auto&& x, auto&&... xs) {
+            element_t<Tuple> acc = FXX_BENCH_FWD(x);
+            ((acc = heavier{}(std::move(acc), FXX_BENCH_FWD(xs))), ...);
+            return acc;
+        }, std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(hand_t, Tuple&& t) {
+        return heavier{}(
+            heavier{}(
+                heavier{}(
+                    element_t<Tuple>(std::get<0>(std::forward<Tuple>(t))),
+                    std::get<1>(std::forward<Tuple>(t))
+                ),
+                std::get<2>(std::forward<Tuple>(t))
+            ),
+            std::get<3>(std::forward<Tuple>(t))
+        );
+    }
+};
+
+// Matches the last element, so that every element is visited.
+struct first_op {
+    static constexpr const char* name = "first";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static std::optional<std::size_t> run(fxx_t, const Tuple& t) {
+        const auto k = weight(std::get<3>(t));
+        return fxx::tuple::first([k](const auto& x) { return weight(x) == k; }, t);
+    }
+    template<class Tuple>
+    static std::optional<std::size_t> run(apply_t, const Tuple& t) {
+        const auto k = weight(std::get<3>(t));
+        return std::apply([k](const auto&... xs) {
+            std::size_t i = 0;
+            const bool found = ((weight(xs) == k || (++i, false)) || ...);
+            return found ? std::optional<std::size_t>{i} : std::nullopt;
+        }, t);
+    }
+    template<class Tuple>
+    static std::optional<std::size_t> run(hand_t, const Tuple& t) {
+        const auto k = weight(std::get<3>(t));
+        if (weight(std::get<0>(t)) == k) return 0;
+        if (weight(std::get<1>(t)) == k) return 1;
+        if (weight(std::get<2>(t)) == k) return 2;
+        if (weight(std::get<3>(t)) == k) return 3;
+        return std::nullopt;
+    }
+};
+
+// Finds the last element, so that every element is compared.
+struct find_op {
+    static constexpr const char* name = "find";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static std::optional<std::size_t> run(fxx_t, const Tuple& t) {
+        return fxx::tuple::find(std::get<3>(t), t);
+    }
+    template<class Tuple>
+    static std::optional<std::size_t> run(apply_t, const Tuple& t) {
+        const auto& value = std::get<3>(t);
+        return std::apply([&](const auto&... xs) {
+            std::size_t i = 0;
+            const bool found = ((xs == value || (++i, false)) || ...);
+            return found ? std::optional<std::size_t>{i} : std::nullopt;
+        }, t);
+    }
+    template<class Tuple>
+    static std::optional<std::size_t> run(hand_t, const Tuple& t) {
+        const auto& value = std::get<3>(t);
+        if (std::get<0>(t) == value) return 0;
+        if (std::get<1>(t) == value) return 1;
+        if (std::get<2>(t) == value) return 2;
+        if (std::get<3>(t) == value) return 3;
+        return std::nullopt;
+    }
+};
+
+struct pick_op {
+    static constexpr const char* name = "pick";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static auto run(fxx_t, Tuple&& t) {
+        return fxx::tuple::pick<3, 1, 0>(std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(apply_t, Tuple&& t) {
+        using T = element_t<Tuple>;
+        return std::apply([](auto&& a, auto&& b, auto&&, auto&& d) {
+            return std::tuple<T, T, T>(FXX_BENCH_FWD(d), FXX_BENCH_FWD(b), FXX_BENCH_FWD(a));
+        }, std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(hand_t, Tuple&& t) {
+        using T = element_t<Tuple>;
+        return std::tuple<T, T, T>(
+            std::get<3>(std::forward<Tuple>(t)),
+            std::get<1>(std::forward<Tuple>(t)),
+            std::get<0>(std::forward<Tuple>(t))
+        );
+    }
+};
+
+struct slice_op {
+    static constexpr const char* name = "slice";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static auto run(fxx_t, Tuple&& t) {
+        return fxx::tuple::slice<1, 2>(std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(apply_t, Tuple&& t) {
+        using T = element_t<Tuple>;
+        return std::apply([](auto&&, auto&& b, auto&& c, auto&&) {
+            return std::tuple<T, T>(FXX_BENCH_FWD(b), FXX_BENCH_FWD(c));
+        }, std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(hand_t, Tuple&& t) {
+        using T = element_t<Tuple>;
+        return std::tuple<T, T>(
+            std::get<1>(std::forward<Tuple>(t)),
+            std::get<2>(std::forward<Tuple>(t))
+        );
+    }
+};
+
+struct flip_op {
+    static constexpr const char* name = "flip";
+    template<class T> static constexpr bool enabled = true;
+
+    template<class Tuple>
+    static auto run(fxx_t, Tuple&& t) {
+        return fxx::tuple::flip(std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(apply_t, Tuple&& t) {
+        return std::apply([](auto&& a, auto&& b, auto&& c, auto&& d) {
+            return tuple4<element_t<Tuple>>(
+                FXX_BENCH_FWD(d),
+                FXX_BENCH_FWD(c),
+                FXX_BENCH_FWD(b),
+                FXX_BENCH_FWD(a)
+            );
+        }, std::forward<Tuple>(t));
+    }
+    template<class Tuple>
+    static auto run(hand_t, Tuple&& t) {
+        return tuple4<element_t<Tuple>>(
+            std::get<3>(std::forward<Tuple>(t)),
+            std::get<2>(std::forward<Tuple>(t)),
+            std::get<1>(std::forward<Tuple>(t)),
+            std::get<0>(std::forward<Tuple>(t))
+        );
+    }
+};
+
+// Duplication copies its input, so it is not applicable to move-only elements.
+struct dup_op {
+    static constexpr const char* name = "dup";
+    template<class T> static constexpr bool enabled = std::is_copy_constructible_v<T>;
+
+    template<class Tuple>
+    static auto run(fxx_t, const Tuple& t) {
+        return fxx::tuple::dup<2>(t);
+    }
+    template<class Tuple>
+    static auto run(apply_t, const Tuple& t) {
+        return std::apply([](const auto&... xs) {
+            return std::tuple_cat(std::make_tuple(xs...), std::make_tuple(xs...));
+        }, t);
+    }
+    template<class Tuple>
+    static auto run(hand_t, const Tuple& t) {
+        using T = element_t<Tuple>;
+        return std::tuple<T, T, T, T, T, T, T, T>(
+            std::get<0>(t), std::get<1>(t), std::get<2>(t), std::get<3>(t),
+            std::get<0>(t), std::get<1>(t), std::get<2>(t), std::get<3>(t)
+        );
+    }
+};
+
+#undef FXX_BENCH_FWD
+
+template<class Op, class T, class Variant>
+void bench(benchmark::State& state) {
+    auto tuple = tuple4<T>(
+        element<T>::make(0),
+        element<T>::make(1),
+        element<T>::make(2),
+        element<T>::make(3)
+    );
+
+    counters::reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tuple);
+        auto result = Op::run(Variant{}, input(tuple));
+        benchmark::DoNotOptimize(result);
+    }
+
+    if constexpr (element<T>::instrumented) {
+        const auto copies = static_cast<double>(counters::copies);
+        const auto moves = static_cast<double>(counters::moves);
+        state.counters["copies"] = benchmark::Counter(copies, benchmark::Counter::kAvgIterations);
+        state.counters["moves"] = benchmark::Counter(moves, benchmark::Counter::kAvgIterations);
+    }
+}
+
+template<class Op, class T, class... Variants>
+void register_variants() {
+    if constexpr (Op::template enabled<T>) {
+        (
+            benchmark::RegisterBenchmark(
+                (std::string(Op::name) + "/" + element<T>::name + "/" + Variants::name).c_str(),
+                &bench<Op, T, Variants>
+            ),
+            ...
+        );
+    }
+}
+
+template<class Op>
+void register_op() {
+    register_variants<Op, int, fxx_t, apply_t, hand_t>();
+    register_variants<Op, double, fxx_t, apply_t, hand_t>();
+    register_variants<Op, std::string, fxx_t, apply_t, hand_t>();
+    register_variants<Op, counted, fxx_t, apply_t, hand_t>();
+    register_variants<Op, move_only, fxx_t, apply_t, hand_t>();
+}
+
+// Wide homogeneous tuples for comparing the tree-shaped and linear reductions.
+template<class T, std::size_t N>
+using wide_t = fxx::meta::tuple_dup_t<N, std::tuple<T>>;
+
+template<class T, std::size_t... Ns>
+wide_t<T, sizeof...(Ns)> make_wide(std::index_sequence<Ns...>) {
+    return {element<T>::make(static_cast<int>(Ns))...};
+}
+
+// Reduction variants.
+struct reduce_t { static constexpr const char* name = "reduce"; };
+struct reduce_tree_t { static constexpr const char* name = "reduce_tree"; };
+struct fold_t { static constexpr const char* name = "fold"; };
+struct fold_tree_t { static constexpr const char* name = "fold_tree"; };
+
+// Sum of doubles, which the compiler may not reassociate.
+struct sum_op {
+    static constexpr const char* name = "sum";
+    using type = double;
+    using fn = std::plus<>;
+    static constexpr type init = 0.0;
+};
+
+// Bitwise OR of integers, which the compiler may reassociate.
+struct or_op {
+    static constexpr const char* name = "or";
+    using type = int;
+    using fn = std::bit_or<>;
+    static constexpr type init = 0;
+};
+
+template<class Op, class Tuple>
+auto reduce_wide(reduce_t, const Tuple& t) {
+    return fxx::tuple::reduce(typename Op::fn{}, t);
+}
+template<class Op, class Tuple>
+auto reduce_wide(reduce_tree_t, const Tuple& t) {
+    return fxx::tuple::reduce_tree(typename Op::fn{}, t);
+}
+template<class Op, class Tuple>
+auto reduce_wide(fold_t, const Tuple& t) {
+    return fxx::tuple::fold(typename Op::fn{}, Op::init, t);
+}
+template<class Op, class Tuple>
+auto reduce_wide(fold_tree_t, const Tuple& t) {
+    return fxx::tuple::fold_tree(typename Op::fn{}, Op::init, t);
+}
+
+template<class Op, std::size_t N, class Variant>
+void bench_wide(benchmark::State& state) {
+    auto tuple = make_wide<typename Op::type>(std::make_index_sequence<N>{});
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tuple);
+        auto result = reduce_wide<Op>(Variant{}, tuple);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template<class Op, std::size_t N, class... Variants>
+void register_wide_variants() {
+    (
+        benchmark::RegisterBenchmark(
+            (
+                std::string(Op::name) + "/" + element<typename Op::type>::name + "/"
+                + std::to_string(N) + "/" + Variants::name
+            ).c_str(),
+            &bench_wide<Op, N, Variants>
+        ),
+        ...
+    );
+}
+
+template<class Op>
+void register_wide_op() {
+    register_wide_variants<Op, 16, reduce_t, reduce_tree_t, fold_t, fold_tree_t>();
+    register_wide_variants<Op, 32, reduce_t, reduce_tree_t, fold_t, fold_tree_t>();
+    register_wide_variants<Op, 64, reduce_t, reduce_tree_t, fold_t, fold_tree_t>();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    register_op<map_op>();
+    register_op<fold_op>();
+    register_op<reduce_op>();
+    register_op<first_op>();
+    register_op<find_op>();
+    register_op<pick_op>();
+    register_op<slice_op>();
+    register_op<flip_op>();
+    register_op<dup_op>();
+
+    register_wide_op<sum_op>();
+    register_wide_op<or_op>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
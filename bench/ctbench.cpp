@@ -0,0 +1,416 @@
+/** Implements the compile-time benchmark driver.
+ *
+ * Generates one translation unit per benchmark case and size, compiles each of them with the
+ * given compiler, and records the wall time, the peak resident set size of the compiler and, where
+ * the compiler supports `-ftime-trace`, the number of template instantiations. The results are
+ * written to `results.csv` and `results.json` in the output directory, in a stable order so that
+ * they can be diffed across releases.
+ *
+ * @code{.unparsed}
+ * fxx-ctbench-driver --compiler <path> --include <dir> --output <dir>
+ *                    [--sizes <n>,<n>,...] [--time-trace] [-- <compiler flags>...]
+ * @endcode
+ *
+ * @file        ctbench.cpp
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <chrono>
+// std::chrono::(duration, steady_clock)
+#include <cstdlib>
+// std::(EXIT_FAILURE, EXIT_SUCCESS, strtoull, system)
+#include <filesystem>
+// std::filesystem::(create_directories, path, remove)
+#include <fstream>
+// std::(ifstream, ofstream)
+#include <iostream>
+// std::(cerr, cout)
+#include <iterator>
+// std::istreambuf_iterator
+#include <optional>
+// std::optional
+#include <sstream>
+// std::ostringstream
+#include <string>
+// std::string
+#include <vector>
+// std::vector
+
+#include <cstddef>
+// std::size_t
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+// open
+#include <sys/resource.h>
+// rusage
+#include <sys/wait.h>
+// wait4, WEXITSTATUS, WIFEXITED
+#include <unistd.h>
+// _exit, dup2, execvp, fork
+#define FXX_CTBENCH_POSIX
+#endif
+
+namespace {
+
+// Common head of all generated translation units, followed by the definition of N.
+constexpr const char* prelude = R"(#include <fxx/meta.h>
+#include <fxx/tuple.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+)";
+
+// Common helpers of all generated translation units.
+constexpr const char* helpers = R"(
+template<std::size_t I>
+struct e { static constexpr std::size_t value = I; };
+
+template<class>
+struct types_impl;
+template<std::size_t... Is>
+struct types_impl<std::index_sequence<Is...>> {
+    using type = std::tuple<e<Is>...>;
+    using reverse = std::index_sequence<(N - 1 - Is)...>;
+};
+
+using types = typename types_impl<std::make_index_sequence<N>>::type;
+using reverse = typename types_impl<std::make_index_sequence<N>>::reverse;
+
+template<class T>
+using is_even = std::bool_constant<T::value % 2 == 0>;
+template<class L, class R>
+using max_t = std::conditional_t<(L::value < R::value), R, L>;
+
+template<class>
+struct pick_reverse;
+template<std::size_t... Is>
+struct pick_reverse<std::index_sequence<Is...>> {
+    using type = fxx::meta::tuple_pick_t<types, Is...>;
+};
+)";
+
+struct bench_case {
+    const char* name;
+    const char* body;
+};
+
+// Benchmark cases. The baseline only pays for the prelude, and is subtracted when comparing.
+const bench_case cases[] = {
+    {"baseline", R"(
+static_assert(std::tuple_size_v<types> == N);
+)"},
+    {"tuple_cat_t", R"(
+static_assert(std::tuple_size_v<fxx::meta::tuple_cat_t<types, types>> == 2 * N);
+)"},
+    {"tuple_flip_t", R"(
+static_assert(std::is_same_v<fxx::meta::type_at_t<0, fxx::meta::tuple_flip_t<types>>, e<N - 1>>);
+)"},
+    {"tuple_pick_t", R"(
+static_assert(std::is_same_v<
+    fxx::meta::type_at_t<0, typename pick_reverse<reverse>::type>,
+    e<N - 1>
+>);
+)"},
+    {"tuple_filter_t", R"(
+static_assert(std::tuple_size_v<fxx::meta::tuple_filter_t<is_even, types>> == (N + 1) / 2);
+)"},
+    {"tuple_reduce_t", R"(
+static_assert(fxx::meta::tuple_reduce_t<max_t, types>::value == N - 1);
+)"},
+    {"find", R"(
+static_assert(fxx::meta::find<e<N - 1>, types>::index == N - 1);
+)"},
+    {"map", R"(
+auto bench(const types& t) {
+    return fxx::tuple::map([](auto x) { return x.value; }, t);
+}
+)"},
+    {"fold", R"(
+std::size_t bench(const types& t) {
+    return fxx::tuple::fold([](std::size_t acc, auto x) { return acc + x.value; }, 0, t);
+}
+)"},
+    {"for_each", R"(
+std::size_t bench(const types& t) {
+    std::size_t sum = 0;
+    fxx::tuple::for_each([&](auto x) { sum += x.value; }, t);
+    return sum;
+}
+)"},
+    {"first", R"(
+std::size_t bench(const types& t, std::size_t i) {
+    return fxx::tuple::first([i](auto x) { return x.value == i; }, t).value_or(N);
+}
+)"},
+    {"reduce", R"(
+auto bench() {
+    return fxx::tuple::reduce(
+        [](auto l, auto r) { return max_t<decltype(l), decltype(r)>{}; },
+        types{}
+    );
+}
+)"},
+    {"visit_at", R"(
+std::size_t bench(const types& t, std::size_t i) {
+    return fxx::tuple::visit_at(i, [](auto x) { return x.value; }, t);
+}
+)"},
+};
+
+struct options {
+    std::string compiler;
+    std::string include;
+    std::filesystem::path output;
+    std::vector<std::size_t> sizes{8, 64, 256, 1024};
+    bool time_trace = false;
+    std::vector<std::string> flags;
+};
+
+struct result {
+    const char* name;
+    std::size_t size;
+    bool ok;
+    double wall_ms;
+    std::optional<long> peak_rss_kb;
+    std::optional<long> instantiations;
+};
+
+struct run_status {
+    bool ok;
+    std::optional<long> peak_rss_kb;
+};
+
+std::optional<options> parse(int argc, char** argv) {
+    options opts;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (arg == "--") {
+            opts.flags.assign(argv + i + 1, argv + argc);
+            break;
+        } else if (arg == "--time-trace") {
+            opts.time_trace = true;
+        } else if (arg == "--compiler" && has_value) {
+            opts.compiler = argv[++i];
+        } else if (arg == "--include" && has_value) {
+            opts.include = argv[++i];
+        } else if (arg == "--output" && has_value) {
+            opts.output = argv[++i];
+        } else if (arg == "--sizes" && has_value) {
+            opts.sizes.clear();
+            for (const char* it = argv[++i]; *it;) {
+                char* end;
+                opts.sizes.push_back(std::strtoull(it, &end, 10));
+                if (end == it || opts.sizes.back() == 0) {
+                    return std::nullopt;
+                }
+                it = *end == ',' ? end + 1 : end;
+            }
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    if (opts.compiler.empty() || opts.include.empty() || opts.output.empty()) {
+        return std::nullopt;
+    }
+    return opts;
+}
+
+// Run a command with its output redirected to a log file, and obtain its peak RSS.
+run_status run(const std::vector<std::string>& command, const std::filesystem::path& log) {
+#ifdef FXX_CTBENCH_POSIX
+    std::vector<char*> args;
+    for (const auto& arg : command) {
+        args.push_back(const_cast<char*>(arg.c_str()));
+    }
+    args.push_back(nullptr);
+
+    const pid_t pid = fork();
+    if (pid == 0) {
+        const int fd = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0) {
+            dup2(fd, 1);
+            dup2(fd, 2);
+        }
+        execvp(args[0], args.data());
+        _exit(127);
+    } else if (pid < 0) {
+        return {false, std::nullopt};
+    }
+
+    int status = 0;
+    rusage usage{};
+    if (wait4(pid, &status, 0, &usage) != pid) {
+        return {false, std::nullopt};
+    }
+
+#ifdef __APPLE__
+    const long peak_rss_kb = static_cast<long>(usage.ru_maxrss / 1024);
+#else
+    const long peak_rss_kb = static_cast<long>(usage.ru_maxrss);
+#endif
+    return {WIFEXITED(status) && WEXITSTATUS(status) == 0, peak_rss_kb};
+#else
+    // Without POSIX process control, fall back to the shell and forgo the RSS measurement.
+    std::string line;
+    for (const auto& arg : command) {
+        line += '"' + arg + "\" ";
+    }
+    line += "> \"" + log.string() + "\" 2>&1";
+    return {std::system(line.c_str()) == 0, std::nullopt};
+#endif
+}
+
+// Count the template instantiation events in a -ftime-trace output file.
+std::optional<long> count_instantiations(const std::filesystem::path& trace) {
+    std::ifstream in(trace);
+    if (!in) {
+        return std::nullopt;
+    }
+    const std::string json{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+
+    long count = 0;
+    for (const std::string event : {"InstantiateClass", "InstantiateFunction"}) {
+        const std::string key = "\"name\":\"" + event + "\"";
+        for (auto pos = json.find(key); pos != std::string::npos; pos = json.find(key, pos + 1)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+result bench(const options& opts, const bench_case& c, std::size_t size) {
+    const std::string stem = std::string(c.name) + "_" + std::to_string(size);
+    const auto source = opts.output / (stem + ".cpp");
+    const auto object = opts.output / (stem + ".o");
+    const auto trace = opts.output / (stem + ".json");
+
+    {
+        std::ofstream out(source);
+        out << prelude << "\nconstexpr std::size_t N = " << size << ";\n" << helpers << c.body;
+    }
+    std::filesystem::remove(trace);
+
+    std::vector<std::string> command{opts.compiler, "-std=c++17", "-I" + opts.include};
+    if (opts.time_trace) {
+        command.push_back("-ftime-trace");
+        command.push_back("-ftime-trace-granularity=0");
+    }
+    command.insert(command.end(), opts.flags.begin(), opts.flags.end());
+    command.insert(command.end(), {"-c", source.string(), "-o", object.string()});
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto status = run(command, opts.output / (stem + ".log"));
+    const std::chrono::duration<double, std::milli> wall = std::chrono::steady_clock::now() - start;
+
+    return {
+        c.name,
+        size,
+        status.ok,
+        wall.count(),
+        status.peak_rss_kb,
+        opts.time_trace && status.ok ? count_instantiations(trace) : std::nullopt,
+    };
+}
+
+std::string escape(const std::string& str) {
+    std::string escaped;
+    for (const char ch : str) {
+        if (ch == '"' || ch == '\\') {
+            escaped += '\\';
+        }
+        escaped += ch;
+    }
+    return escaped;
+}
+
+template<class T>
+std::string format(const std::optional<T>& value, const char* empty) {
+    return value ? std::to_string(*value) : empty;
+}
+
+void write_csv(const std::filesystem::path& path, const std::vector<result>& results) {
+    std::ofstream out(path);
+    out << "case,size,status,wall_ms,peak_rss_kb,instantiations\n";
+    for (const auto& r : results) {
+        std::ostringstream wall;
+        wall.precision(1);
+        wall << std::fixed << r.wall_ms;
+
+        out << r.name << ',' << r.size << ',' << (r.ok ? "ok" : "error") << ','
+            << wall.str() << ',' << format(r.peak_rss_kb, "") << ','
+            << format(r.instantiations, "") << '\n';
+    }
+}
+
+void write_json(
+    const std::filesystem::path& path,
+    const options& opts,
+    const std::vector<result>& results
+) {
+    std::ofstream out(path);
+    out << "{\n  \"compiler\": \"" << escape(opts.compiler) << "\",\n  \"flags\": [";
+    for (std::size_t i = 0; i < opts.flags.size(); ++i) {
+        out << (i ? ", " : "") << '"' << escape(opts.flags[i]) << '"';
+    }
+    out << "],\n  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::ostringstream wall;
+        wall.precision(1);
+        wall << std::fixed << r.wall_ms;
+
+        out << "    {\"case\": \"" << r.name << "\", \"size\": " << r.size
+            << ", \"status\": \"" << (r.ok ? "ok" : "error") << "\", \"wall_ms\": " << wall.str()
+            << ", \"peak_rss_kb\": " << format(r.peak_rss_kb, "null")
+            << ", \"instantiations\": " << format(r.instantiations, "null") << '}'
+            << (i + 1 < results.size() ? "," : "") << '\n';
+    }
+    out << "  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const auto opts = parse(argc, argv);
+    if (!opts) {
+        std::cerr
+            << "Usage: " << argv[0] << " --compiler <path> --include <dir> --output <dir>"
+            << " [--sizes <n>,<n>,...] [--time-trace] [-- <compiler flags>...]\n";
+        return EXIT_FAILURE;
+    }
+
+    std::filesystem::create_directories(opts->output);
+
+    std::vector<result> results;
+    for (const auto& c : cases) {
+        for (const auto size : opts->sizes) {
+            results.push_back(bench(*opts, c, size));
+
+            const auto& r = results.back();
+            std::cout
+                << r.name << " N=" << r.size << ": " << (r.ok ? "ok" : "error") << ", "
+                << static_cast<long>(r.wall_ms) << " ms, "
+                << format(r.peak_rss_kb, "?") << " kB, "
+                << format(r.instantiations, "?") << " instantiations" << std::endl;
+        }
+    }
+
+    write_csv(opts->output / "results.csv", results);
+    write_json(opts->output / "results.json", *opts, results);
+
+    std::cout << "Results written to " << (opts->output / "results.{csv,json}").string() << '\n';
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/** Backport of the C++20 feature std::countr_zero.
+ *
+ * @file        cxx/countr_zero.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_CXX_COUNTR_ZERO_H
+#define FXX_CXX_COUNTR_ZERO_H
+#pragma once
+
+#if __cplusplus > 201703L
+// C++20
+
+#include <bit>
+// std::countr_zero
+
+#else
+// C++17
+
+#define FXX_CXX_COUNTR_ZERO
+
+#include <limits>
+// std::numeric_limits
+#include <type_traits>
+// std::(enable_if_t, is_integral_v, is_same_v, is_unsigned_v)
+
+namespace std {
+
+/** Count the number of consecutive 0 bits, starting from the least significant bit.
+ *
+ * @tparam  T   Unsigned integer type.
+ *
+ * @param   [in]    x   Value.
+ *
+ * @return  Number of trailing 0 bits, or the number of bits in @p T if @p x is 0.
+ */
+template<
+    class T,
+    class = std::enable_if_t<
+        std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>
+    >
+>
+constexpr int countr_zero(T x) noexcept {
+    if (x == 0) {
+        return std::numeric_limits<T>::digits;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (std::numeric_limits<T>::digits <= std::numeric_limits<unsigned>::digits) {
+        return __builtin_ctz(x);
+    } else if constexpr (
+        std::numeric_limits<T>::digits <= std::numeric_limits<unsigned long long>::digits
+    ) {
+        return __builtin_ctzll(x);
+    }
+#endif
+
+    int count = 0;
+    for (; (x & 1) == 0; x >>= 1) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace std
+
+#endif
+
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// VERIFICATION USING STATIC ASSERTIONS
+//--------------------------------------------------------------------------------------------------
+
+#ifdef FXX_TEST_STATIC
+#ifdef FXX_CXX_COUNTR_ZERO
+
+#include <cstdint>
+// std::(uint8_t, uint64_t)
+
+namespace fxx_cxx_countr_zero_h {
+
+static_assert(
+    std::countr_zero(std::uint8_t{0}) == 8,
+    "std::countr_zero: Zero case"
+);
+static_assert(
+    std::countr_zero(std::uint8_t{0b10100}) == 2,
+    "std::countr_zero: Regular case"
+);
+static_assert(
+    std::countr_zero(std::uint64_t{1} << 63) == 63,
+    "std::countr_zero: Wide case"
+);
+
+} // namespace fxx_cxx_countr_zero_h
+
+#endif
+#endif
@@ -0,0 +1,254 @@
+/** Backport of the C++20 feature std::span.
+ *
+ * Only the subset that is needed by this library is provided: contiguous views of arrays,
+ * std::arrays and containers with `data()` and `size()`, element access, sub-views and the byte
+ * conversions. The extent is stored at runtime for both static and dynamic extents.
+ *
+ * @file        cxx/span.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_CXX_SPAN_H
+#define FXX_CXX_SPAN_H
+#pragma once
+
+#if __cplusplus > 201703L
+// C++20
+
+#include <span>
+// std::(as_bytes, as_writable_bytes, dynamic_extent, span)
+
+#else
+// C++17
+
+#define FXX_CXX_SPAN
+
+#include <array>
+// std::array
+#include <cstddef>
+// std::(byte, ptrdiff_t, size_t)
+#include <iterator>
+// std::(data, size)
+#include <limits>
+// std::numeric_limits
+#include <type_traits>
+// std::(enable_if_t, false_type, is_array_v, is_const_v, is_convertible_v, remove_cv_t,
+//       remove_pointer_t, true_type)
+#include <utility>
+// std::declval
+
+namespace std {
+
+inline constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+template<class T, std::size_t Extent = dynamic_extent>
+class span;
+
+namespace detail {
+
+template<class>
+struct is_span_or_array : std::false_type {};
+
+template<class T, std::size_t Extent>
+struct is_span_or_array<span<T, Extent>> : std::true_type {};
+
+template<class T, std::size_t N>
+struct is_span_or_array<std::array<T, N>> : std::true_type {};
+
+// Indicates whether a span of T can view a container.
+template<class T, class Container, class = void>
+static constexpr bool is_span_compatible_v = false;
+
+template<class T, class Container>
+static constexpr bool is_span_compatible_v<T, Container, std::void_t<
+    decltype(std::data(std::declval<Container&>())),
+    decltype(std::size(std::declval<Container&>()))
+>> = !is_span_or_array<std::remove_cv_t<Container>>::value
+    && !std::is_array_v<Container>
+    && std::is_convertible_v<
+        std::remove_pointer_t<decltype(std::data(std::declval<Container&>()))>(*)[],
+        T(*)[]
+    >;
+
+} // namespace detail
+
+/** Non-owning view of a contiguous sequence of objects.
+ *
+ * @tparam  T       Element type.
+ * @tparam  Extent  Number of elements, or std::dynamic_extent.
+ */
+template<class T, std::size_t Extent>
+class span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+
+    static constexpr std::size_t extent = Extent;
+
+    template<std::size_t E = Extent, class = std::enable_if_t<E == 0 || E == dynamic_extent>>
+    constexpr span() noexcept : m_data{nullptr}, m_size{0} {}
+
+    constexpr span(pointer first, size_type count) noexcept : m_data{first}, m_size{count} {}
+    constexpr span(pointer first, pointer last) noexcept
+    : m_data{first}, m_size{static_cast<size_type>(last - first)} {}
+
+    template<std::size_t N, class = std::enable_if_t<Extent == dynamic_extent || Extent == N>>
+    constexpr span(element_type (&arr)[N]) noexcept : m_data{arr}, m_size{N} {}
+
+    template<
+        class U,
+        std::size_t N,
+        class = std::enable_if_t<
+            (Extent == dynamic_extent || Extent == N) && std::is_convertible_v<U(*)[], T(*)[]>
+        >
+    >
+    constexpr span(std::array<U, N>& arr) noexcept : m_data{arr.data()}, m_size{N} {}
+
+    template<
+        class U,
+        std::size_t N,
+        class = std::enable_if_t<
+            (Extent == dynamic_extent || Extent == N)
+            && std::is_convertible_v<const U(*)[], T(*)[]>
+        >
+    >
+    constexpr span(const std::array<U, N>& arr) noexcept : m_data{arr.data()}, m_size{N} {}
+
+    template<
+        class Container,
+        class = std::enable_if_t<detail::is_span_compatible_v<T, Container>>
+    >
+    constexpr span(Container& container)
+    : m_data{std::data(container)}, m_size{std::size(container)} {}
+
+    template<
+        class Container,
+        class = std::enable_if_t<detail::is_span_compatible_v<T, const Container>>
+    >
+    constexpr span(const Container& container)
+    : m_data{std::data(container)}, m_size{std::size(container)} {}
+
+    template<
+        class U,
+        std::size_t N,
+        class = std::enable_if_t<
+            (Extent == dynamic_extent || Extent == N) && std::is_convertible_v<U(*)[], T(*)[]>
+        >
+    >
+    constexpr span(const span<U, N>& other) noexcept : m_data{other.data()}, m_size{other.size()} {}
+
+    constexpr iterator begin() const noexcept { return m_data; }
+    constexpr iterator end() const noexcept { return m_data + m_size; }
+
+    constexpr reference front() const noexcept { return m_data[0]; }
+    constexpr reference back() const noexcept { return m_data[m_size - 1]; }
+    constexpr reference operator[](size_type i) const noexcept { return m_data[i]; }
+    constexpr pointer data() const noexcept { return m_data; }
+
+    constexpr size_type size() const noexcept { return m_size; }
+    constexpr size_type size_bytes() const noexcept { return m_size * sizeof(T); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0; }
+
+    constexpr span<T> first(size_type count) const noexcept { return {m_data, count}; }
+    constexpr span<T> last(size_type count) const noexcept {
+        return {m_data + (m_size - count), count};
+    }
+    constexpr span<T> subspan(size_type offset, size_type count = dynamic_extent) const noexcept {
+        return {m_data + offset, count == dynamic_extent ? m_size - offset : count};
+    }
+
+private:
+    pointer m_data;
+    size_type m_size;
+};
+
+template<class T, std::size_t N>
+span(T (&)[N]) -> span<T, N>;
+
+template<class T, std::size_t N>
+span(std::array<T, N>&) -> span<T, N>;
+
+template<class T, std::size_t N>
+span(const std::array<T, N>&) -> span<const T, N>;
+
+template<class Container>
+span(Container&) -> span<std::remove_pointer_t<decltype(std::data(std::declval<Container&>()))>>;
+
+template<class Container>
+span(const Container&)
+-> span<std::remove_pointer_t<decltype(std::data(std::declval<const Container&>()))>>;
+
+/** Get a view of the object representations of the elements of a span. */
+template<class T, std::size_t N>
+span<const std::byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>
+as_bytes(span<T, N> s) noexcept {
+    return {reinterpret_cast<const std::byte*>(s.data()), s.size_bytes()};
+}
+
+/** Get a writable view of the object representations of the elements of a span. */
+template<class T, std::size_t N, class = std::enable_if_t<!std::is_const_v<T>>>
+span<std::byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>
+as_writable_bytes(span<T, N> s) noexcept {
+    return {reinterpret_cast<std::byte*>(s.data()), s.size_bytes()};
+}
+
+} // namespace std
+
+#endif
+
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// VERIFICATION USING STATIC ASSERTIONS
+//--------------------------------------------------------------------------------------------------
+
+#ifdef FXX_TEST_STATIC
+#ifdef FXX_CXX_SPAN
+
+#include <type_traits>
+// std::is_same_v
+#include <vector>
+// std::vector
+
+namespace fxx_cxx_span_h {
+
+static constexpr int values[] = {1, 2, 3, 4};
+
+static_assert(
+    std::span(values).size() == 4 && std::span(values)[2] == 3,
+    "std::span: Array case"
+);
+static_assert(
+    std::is_same_v<decltype(std::span(values)), std::span<const int, 4>>,
+    "std::span: Array deduction"
+);
+static_assert(
+    std::span<const int>(values).subspan(1, 2).back() == 3,
+    "std::span: Subspan case"
+);
+static_assert(
+    std::is_same_v<decltype(std::span(std::declval<std::vector<int>&>())), std::span<int>>,
+    "std::span: Container deduction"
+);
+static_assert(
+    std::is_convertible_v<std::span<int>, std::span<const int>>
+    && !std::is_convertible_v<std::span<const int>, std::span<int>>,
+    "std::span: Qualification conversion"
+);
+
+} // namespace fxx_cxx_span_h
+
+#endif
+#endif
@@ -3,7 +3,9 @@
  * A detector is a compile-time expression that examines whether an expression is well-defined, and
  * what type it evaluates to. It can be used to detect whether members and operators are defined.
  *
- * Largely based on the libary fundamentals TS v2, with some additions.
+ * Largely based on the libary fundamentals TS v2, with some additions. When compiling as C++20, the
+ * detection uses a requires-expression instead of std::void_t, and is also published as the
+ * fxx::meta::detected concept.
  *
  * @file        detect.h
  * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
@@ -43,12 +45,42 @@ struct detect_impl {
     using type = Default;
 };
 
+#if __cplusplus > 201703L
+// C++20
+
+} // namespace detail
+
+/** Concept that is satisfied when a template instantiation is valid.
+ *
+ * See is_detected for more details.
+ *
+ * @tparam  Op      Test template.
+ * @tparam  Args    Arguments to @p Op.
+ */
+template<template<class...> class Op, class... Args>
+concept detected = requires { typename Op<Args...>; };
+
+namespace detail {
+
+// Checking the requires-expression is cheaper than substituting into std::void_t.
+template<class Default, template<class...> class Op, class... Args>
+requires detected<Op, Args...>
+struct detect_impl<Default, void, Op, Args...> {
+    using value_t = std::true_type;
+    using type = Op<Args...>;
+};
+
+#else
+// C++17
+
 template<class Default, template<class...> class Op, class... Args>
 struct detect_impl<Default, std::void_t<Op<Args...>>, Op, Args...> {
     using value_t = std::true_type;
     using type = Op<Args...>;
 };
 
+#endif
+
 } // namespace detail
 
 /** A std::bool_constant indicating whether a template instantiation is valid.
@@ -184,6 +216,8 @@ static constexpr bool is_detected_nothrow_convertible_v =
 
 #ifdef FXX_TEST_STATIC
 
+#include <type_traits>
+// std::is_same_v
 #include <utility>
 // std::declval
 
@@ -212,6 +246,19 @@ static_assert(
     "fxx::meta::is_detected_v: Detected"
 );
 
+#if __cplusplus > 201703L
+static_assert(
+    !fxx::meta::detected<it_member_t, has_no_it> && fxx::meta::detected<it_member_t, has_int_it>,
+    "fxx::meta::detected"
+);
+#endif
+
+static_assert(
+    std::is_same_v<long, fxx::meta::detected_or_t<long, it_member_t, has_no_it>>
+    && std::is_same_v<int, fxx::meta::detected_or_t<long, it_member_t, has_int_it>>,
+    "fxx::meta::detected_or_t"
+);
+
 static_assert(
     !fxx::meta::is_detected_exact_v<int, it_member_t, has_no_it>,
     "fxx::meta::is_detected_exact_v: Not detected"
@@ -21,6 +21,13 @@
  *
  *          bind ... Bind template parameters to functor types.
  *       partial ... Partially bind template parameters to concrete types.
+ *
+ * Reasoning:
+ *
+ *           any ... Indicate whether any argument matches a predicate.
+ *           all ... Indicate whether all arguments match a predicate.
+ *          none ... Indicate whether no argument matches a predicate.
+ *      count_if ... Count the arguments that match a predicate.
  * @endcode
  *
  * @file        meta/functional.h
@@ -38,7 +45,11 @@
 #pragma once
 
 #include <type_traits>
-// std::(conditional_t, false_type, true_type)
+// std::(bool_constant, conditional_t, conjunction, disjunction, false_type, integral_constant,
+//       true_type)
+
+#include <cstddef>
+// std::size_t
 
 namespace fxx { namespace meta {
 
@@ -147,24 +158,31 @@ struct partial {
 
 namespace detail {
 
-// Dispatch case.
+// Flat case.
 template<template<class> class Pred, class... Args>
-struct any_impl {};
-
-// Trivial case.
-template<template<class> class Pred>
-struct any_impl<Pred> : std::false_type {};
-
-// Recursive case.
-template<template<class> class Pred, class Head, class... Tail>
-struct any_impl<Pred, Head, Tail...>
-: std::conditional_t<Pred<Head>::value, std::true_type, any_impl<Pred, Tail...>> {};
+struct any_impl : std::bool_constant<std::disjunction<Pred<Args>...>::value> {};
+
+// Block case, which only instantiates the next block if no match was found. Blocks of 8 bound the
+// recursion depth to N / 8, and the std::disjunction inside a block stays shallow.
+template<
+    template<class> class Pred,
+    class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+    class... Tail
+>
+struct any_impl<Pred, A0, A1, A2, A3, A4, A5, A6, A7, Tail...> : std::conditional_t<
+    std::disjunction<
+        Pred<A0>, Pred<A1>, Pred<A2>, Pred<A3>, Pred<A4>, Pred<A5>, Pred<A6>, Pred<A7>
+    >::value,
+    std::true_type,
+    any_impl<Pred, Tail...>
+> {};
 
 } // namespace detail
 
 /** A std::bool_constant indicating whether a predicate is matched by any argument.
  *
- * An empty list of arguments never matches any predicate.
+ * An empty list of arguments never matches any predicate. Predicates are instantiated in order, and
+ * not at all after the first match. The instantiation depth grows with N / 8.
  *
  * @code{.unparsed}
  * any<P, T_0, T_1, ..., T_(N-1)> <=> Ex. i el [0, N): P<T_i>::value = true
@@ -196,24 +214,30 @@ static constexpr bool any_v = any<Pred, Args...>::value;
 
 namespace detail {
 
-// Dispatch case.
+// Flat case.
 template<template<class> class Pred, class... Args>
-struct all_impl {};
-
-// Trivial case.
-template<template<class> class Pred>
-struct all_impl<Pred> : std::true_type {};
-
-// Recursive case.
-template<template<class> class Pred, class Head, class... Tail>
-struct all_impl<Pred, Head, Tail...>
-: std::conditional_t<Pred<Head>::value, all_impl<Pred, Tail...>, std::false_type> {};
+struct all_impl : std::bool_constant<std::conjunction<Pred<Args>...>::value> {};
+
+// Block case, which only instantiates the next block if no mismatch was found.
+template<
+    template<class> class Pred,
+    class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+    class... Tail
+>
+struct all_impl<Pred, A0, A1, A2, A3, A4, A5, A6, A7, Tail...> : std::conditional_t<
+    std::conjunction<
+        Pred<A0>, Pred<A1>, Pred<A2>, Pred<A3>, Pred<A4>, Pred<A5>, Pred<A6>, Pred<A7>
+    >::value,
+    all_impl<Pred, Tail...>,
+    std::false_type
+> {};
 
 } // namespace detail
 
 /** A std::bool_constant indicating whether a predicate is matched by all arguments.
  *
- * An empty list of arguments matches all predicates.
+ * An empty list of arguments matches all predicates. Predicates are instantiated in order, and not
+ * at all after the first mismatch. The instantiation depth grows with N / 8.
  *
  * @code{.unparsed}
  * all<P, T_0, T_1, ..., T_(N-1)> <=> A. i el [0, N): P<T_i>::value = true
@@ -243,6 +267,67 @@ using all = detail::all_impl<Pred, Args...>;
 template<template<class> class Pred, class... Args>
 static constexpr bool all_v = all<Pred, Args...>::value;
 
+/** A std::bool_constant indicating whether a predicate is matched by no argument.
+ *
+ * An empty list of arguments never matches any predicate. Predicates are instantiated like in any.
+ *
+ * @code{.unparsed}
+ * none<P, T_0, T_1, ..., T_(N-1)> <=> !any<P, T_0, T_1, ..., T_(N-1)>
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Pred instances do not provide a
+ *          `static constexpr bool value`.
+ *
+ * @tparam  Pred    Predicate type.
+ * @tparam  Args    Arguments.
+ */
+template<template<class> class Pred, class... Args>
+using none = std::bool_constant<!any_v<Pred, Args...>>;
+
+/** A compile-time constant indicating whether a predicate is matched by no argument.
+ *
+ * See none for more details.
+ *
+ * @tparam  Pred    Predicate type.
+ * @tparam  Args    Arguments.
+ */
+template<template<class> class Pred, class... Args>
+static constexpr bool none_v = none<Pred, Args...>::value;
+
+/** A std::integral_constant counting the arguments that match a predicate.
+ *
+ * All predicates are instantiated, in a single fold expression of constant depth.
+ *
+ * @code{.unparsed}
+ * count_if<P, T_0, T_1, ..., T_(N-1)>::value = |{i el [0, N): P<T_i>::value = true}|
+ *
+ *      where P is the predicate
+ *        and T_i is the i-th input argument
+ *        and N is the number of input arguments
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Pred instances do not provide a
+ *          `static constexpr bool value`.
+ *
+ * @tparam  Pred    Predicate type.
+ * @tparam  Args    Arguments.
+ */
+template<template<class> class Pred, class... Args>
+using count_if = std::integral_constant<
+    std::size_t,
+    (std::size_t{0} + ... + static_cast<std::size_t>(Pred<Args>::value))
+>;
+
+/** A compile-time constant counting the arguments that match a predicate.
+ *
+ * See count_if for more details.
+ *
+ * @tparam  Pred    Predicate type.
+ * @tparam  Args    Arguments.
+ */
+template<template<class> class Pred, class... Args>
+static constexpr std::size_t count_if_v = count_if<Pred, Args...>::value;
+
 } } // namespace fxx::meta
 
 #endif
@@ -260,6 +345,19 @@ static constexpr bool all_v = all<Pred, Args...>::value;
 
 namespace fxx { namespace meta {
 
+namespace detail {
+
+// Type that must never be passed to short_circuit.
+struct short_circuit_poison {};
+
+// Signedness predicate that fails to compile when instantiated for short_circuit_poison.
+template<class T>
+struct short_circuit : std::is_signed<T> {
+    static_assert(!std::is_same_v<T, short_circuit_poison>, "Predicate was not short-circuited!");
+};
+
+} // namespace detail
+
 // identity
 static_assert(
     std::is_same_v<int, identity<int, bool>>,
@@ -308,7 +406,7 @@ static_assert(
     "fxx::meta::any: Empty case"
 );
 static_assert(
-    any_v<std::is_signed, ushort, ushort, short, ushort>,
+    any_v<std::is_signed, unsigned short, unsigned short, short, unsigned short>,
     "fxx::meta::any: Regular case"
 );
 
@@ -318,9 +416,55 @@ static_assert(
     "fxx::meta::all: Empty case"
 );
 static_assert(
-    !all_v<std::is_signed, short, short, short, ushort>,
+    !all_v<std::is_signed, short, short, short, unsigned short>,
     "fxx::meta::any: Regular case"
 );
+static_assert(
+    all_v<std::is_signed, short, short, short, short, short, short, short, short, short, short>
+    && !all_v<std::is_signed, short, short, short, short, short, short, short, short, unsigned>,
+    "fxx::meta::all: Block case"
+);
+static_assert(
+    !all_v<detail::short_circuit, short, short, unsigned short, detail::short_circuit_poison>,
+    "fxx::meta::all: Short-circuit case"
+);
+
+// any_v (block)
+static_assert(
+    any_v<std::is_signed, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned,
+        unsigned, unsigned, short>
+    && !any_v<std::is_signed, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned,
+        unsigned, unsigned>,
+    "fxx::meta::any: Block case"
+);
+static_assert(
+    any_v<
+        detail::short_circuit,
+        unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned,
+        short, detail::short_circuit_poison
+    >,
+    "fxx::meta::any: Short-circuit case"
+);
+
+// none_v
+static_assert(
+    none_v<tautology>,
+    "fxx::meta::none: Empty case"
+);
+static_assert(
+    none_v<std::is_signed, unsigned, unsigned short> && !none_v<std::is_signed, unsigned, short>,
+    "fxx::meta::none: Regular case"
+);
+
+// count_if_v
+static_assert(
+    count_if_v<tautology> == 0,
+    "fxx::meta::count_if: Empty case"
+);
+static_assert(
+    count_if_v<std::is_signed, short, unsigned, int, unsigned short, long> == 3,
+    "fxx::meta::count_if: Regular case"
+);
 
 } } // namespace fxx::meta
 
@@ -6,6 +6,10 @@
  * The types declared in this file can be used to manipulate these sequences to achieve complex
  * mappings independent of the container access functions.
  *
+ * Besides the sequence types, the constexpr functions in this file compute index permutations as
+ * ordinary values (std::array and index_buffer), which are turned back into a sequence through
+ * index_sequence_from_t. This costs one instantiation per sequence instead of one per element.
+ *
  * @file        meta/indices.h
  * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
  *
@@ -19,10 +23,10 @@
 #define FXX_META_INDICES_H
 #pragma once
 
+#include <array>
+// std::array
 #include <utility>
-// std::(index_sequence, make_index_sequence)
-#include <type_traits>
-// std::integral_constant
+// std::(index_sequence, integer_sequence, make_index_sequence)
 
 #include <cstddef>
 // std::size_t
@@ -52,16 +56,34 @@ struct map_index_sequence_impl<Fn, std::index_sequence<Ns...>> {
     using type = std::index_sequence<Fn<Ns>::value...>;
 };
 
-template<std::size_t Shift>
-struct shift_index_impl {
-    template<std::size_t N>
-    using type = std::integral_constant<std::size_t, N + Shift>;
+// Dispatch case.
+template<std::size_t, class>
+struct shift_index_impl {};
+
+// Variadic case.
+template<std::size_t Shift, std::size_t... Ns>
+struct shift_index_impl<Shift, std::index_sequence<Ns...>> {
+    using type = std::index_sequence<(Ns + Shift)...>;
+};
+
+// Dispatch case.
+template<std::size_t, class>
+struct scale_index_impl {};
+
+// Variadic case.
+template<std::size_t Scale, std::size_t... Ns>
+struct scale_index_impl<Scale, std::index_sequence<Ns...>> {
+    using type = std::index_sequence<(Ns * Scale)...>;
 };
 
-template<std::size_t Scale>
-struct scale_index_impl {
-    template<std::size_t N>
-    using type = std::integral_constant<std::size_t, N * Scale>;
+// Dispatch case.
+template<const auto&, class>
+struct index_sequence_from_impl {};
+
+// Variadic case.
+template<const auto& Indices, std::size_t... Is>
+struct index_sequence_from_impl<Indices, std::index_sequence<Is...>> {
+    using type = std::index_sequence<Indices[Is]...>;
 };
 
 } // namespace detail
@@ -90,6 +112,9 @@ using apply_index_sequence_t = typename detail::apply_index_sequence_impl<Target
  * template that resolves to an std::integral_constant<std::size_t>. The output sequence will have
  * the same size as the input sequence.
  *
+ * @note    Instantiates @p Fn once per element. Prefer the constexpr index functions (see
+ *          index_sequence_from_t) for mappings that can be expressed as ordinary values.
+ *
  * @code{.unparsed}
  * map_index_sequence_t<Fn, s> = std::index_sequence<Fn<s_0>, Fn<s_1>, ..., Fn<s_(N-1)>>
  *
@@ -125,10 +150,7 @@ using map_index_sequence_t = typename detail::map_index_sequence_impl<Fn, Seq>::
  * @tparam  Seq     Input sequence.
  */
 template<std::size_t Shift, class Seq>
-using shift_index_sequence_t = map_index_sequence_t<
-        detail::shift_index_impl<Shift>::template type,
-        Seq
-    >;
+using shift_index_sequence_t = typename detail::shift_index_impl<Shift, Seq>::type;
 
 /** Scale the elements in an std::index_sequence.
  *
@@ -149,10 +171,7 @@ using shift_index_sequence_t = map_index_sequence_t<
  * @tparam  Seq     Input sequence.
  */
 template<std::size_t Scale, class Seq>
-using scale_index_sequence_t = map_index_sequence_t<
-        detail::scale_index_impl<Scale>::template type,
-        Seq
-    >;
+using scale_index_sequence_t = typename detail::scale_index_impl<Scale, Seq>::type;
 
 /** Make an index range.
  *
@@ -166,6 +185,277 @@ using scale_index_sequence_t = map_index_sequence_t<
 template<std::size_t Start, std::size_t Length>
 using make_index_range = shift_index_sequence_t<Start, std::make_index_sequence<Length>>;
 
+/** Fixed-capacity list of indices, for results whose size depends on their values.
+ *
+ * @tparam  N   Capacity.
+ */
+template<std::size_t N>
+struct index_buffer {
+    /** Storage, of which the first size() elements are used. */
+    std::array<std::size_t, N> data{};
+    /** Number of used elements. */
+    std::size_t count = 0;
+
+    /** Get the number of used elements. */
+    constexpr std::size_t size() const noexcept { return count; }
+    /** Get a used element. */
+    constexpr std::size_t operator[](std::size_t i) const noexcept { return data[i]; }
+    /** Append an element. */
+    constexpr void push_back(std::size_t value) noexcept { data[count++] = value; }
+};
+
+/** Get the elements of an std::index_sequence as a std::array.
+ *
+ * @tparam  Ns  Input sequence elements.
+ *
+ * @return  std::array<std::size_t, sizeof...(Ns)>
+ */
+template<std::size_t... Ns>
+constexpr std::array<std::size_t, sizeof...(Ns)> index_array(std::index_sequence<Ns...>) noexcept {
+    return {{Ns...}};
+}
+
+/** Get an std::index_sequence from the elements of a constexpr index container.
+ *
+ * Bridges indices computed by constexpr functions back into the type system. The container must
+ * be a constexpr object with static storage duration (e.g. a `static constexpr` data member) that
+ * provides constexpr `size()` and `operator[]`, such as std::array or index_buffer.
+ *
+ * @code{.unparsed}
+ * index_sequence_from_t<a> = std::index_sequence<a[0], a[1], ..., a[N-1]>
+ *
+ *      where a is the input container
+ *        and N is a.size()
+ * @endcode
+ *
+ * @tparam  Indices Input container.
+ */
+template<const auto& Indices>
+using index_sequence_from_t = typename detail::index_sequence_from_impl<
+    Indices,
+    std::make_index_sequence<Indices.size()>
+>::type;
+
+/** Add a constant to all indices. */
+template<std::size_t N>
+constexpr std::array<std::size_t, N> index_shift(
+    std::array<std::size_t, N> indices,
+    std::size_t shift
+) noexcept {
+    for (auto& index : indices) index += shift;
+    return indices;
+}
+
+/** Multiply all indices with a constant. */
+template<std::size_t N>
+constexpr std::array<std::size_t, N> index_scale(
+    std::array<std::size_t, N> indices,
+    std::size_t scale
+) noexcept {
+    for (auto& index : indices) index *= scale;
+    return indices;
+}
+
+/** Reverse the order of the indices. */
+template<std::size_t N>
+constexpr std::array<std::size_t, N> index_reverse(const std::array<std::size_t, N>& indices)
+noexcept {
+    std::array<std::size_t, N> result{};
+    for (std::size_t i = 0; i < N; ++i) result[i] = indices[N - 1 - i];
+    return result;
+}
+
+/** Rotate the indices to the left, so that element @p shift becomes the first. */
+template<std::size_t N>
+constexpr std::array<std::size_t, N> index_rotate(
+    const std::array<std::size_t, N>& indices,
+    std::size_t shift
+) noexcept {
+    std::array<std::size_t, N> result{};
+    for (std::size_t i = 0; i < N; ++i) result[i] = indices[(i + shift) % N];
+    return result;
+}
+
+/** Concatenate two index arrays. */
+template<std::size_t N, std::size_t M>
+constexpr std::array<std::size_t, N + M> index_concat(
+    const std::array<std::size_t, N>& lhs,
+    const std::array<std::size_t, M>& rhs
+) noexcept {
+    std::array<std::size_t, N + M> result{};
+    for (std::size_t i = 0; i < N; ++i) result[i] = lhs[i];
+    for (std::size_t i = 0; i < M; ++i) result[N + i] = rhs[i];
+    return result;
+}
+
+/** Interleave two index arrays, appending the excess elements of the longer one. */
+template<std::size_t N, std::size_t M>
+constexpr std::array<std::size_t, N + M> index_interleave(
+    const std::array<std::size_t, N>& lhs,
+    const std::array<std::size_t, M>& rhs
+) noexcept {
+    std::array<std::size_t, N + M> result{};
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < N || i < M; ++i) {
+        if (i < N) result[k++] = lhs[i];
+        if (i < M) result[k++] = rhs[i];
+    }
+    return result;
+}
+
+/** Keep the indices for which the mask is set. */
+template<std::size_t N>
+constexpr index_buffer<N> index_filter(
+    const std::array<std::size_t, N>& indices,
+    const std::array<bool, N>& mask
+) noexcept {
+    index_buffer<N> result{};
+    for (std::size_t i = 0; i < N; ++i) {
+        if (mask[i]) result.push_back(indices[i]);
+    }
+    return result;
+}
+
+/// @cond
+namespace detail {
+
+// Dispatch case.
+template<class>
+struct reverse_index_impl {};
+
+// Flat case.
+template<std::size_t... Ns>
+struct reverse_index_impl<std::index_sequence<Ns...>> {
+    static constexpr auto value = index_reverse(index_array(std::index_sequence<Ns...>{}));
+    using type = index_sequence_from_t<value>;
+};
+
+// Dispatch case.
+template<std::size_t, class>
+struct rotate_index_impl {};
+
+// Flat case.
+template<std::size_t Shift, std::size_t... Ns>
+struct rotate_index_impl<Shift, std::index_sequence<Ns...>> {
+    static constexpr auto value = index_rotate(index_array(std::index_sequence<Ns...>{}), Shift);
+    using type = index_sequence_from_t<value>;
+};
+
+// Dispatch case.
+template<class, class>
+struct concat_index_impl {};
+
+// Flat case.
+template<std::size_t... Ns, std::size_t... Ms>
+struct concat_index_impl<std::index_sequence<Ns...>, std::index_sequence<Ms...>> {
+    using type = std::index_sequence<Ns..., Ms...>;
+};
+
+// Dispatch case.
+template<class, class>
+struct interleave_index_impl {};
+
+// Flat case.
+template<std::size_t... Ns, std::size_t... Ms>
+struct interleave_index_impl<std::index_sequence<Ns...>, std::index_sequence<Ms...>> {
+    static constexpr auto value = index_interleave(
+        index_array(std::index_sequence<Ns...>{}),
+        index_array(std::index_sequence<Ms...>{})
+    );
+    using type = index_sequence_from_t<value>;
+};
+
+// Dispatch case.
+template<class, class>
+struct filter_index_impl {};
+
+// Flat case.
+template<std::size_t... Ns, bool... Mask>
+struct filter_index_impl<std::index_sequence<Ns...>, std::integer_sequence<bool, Mask...>> {
+    static constexpr auto value = index_filter(
+        index_array(std::index_sequence<Ns...>{}),
+        std::array<bool, sizeof...(Mask)>{{Mask...}}
+    );
+    using type = index_sequence_from_t<value>;
+};
+
+} // namespace detail
+/// @endcond
+
+/** Reverse the order of the elements in an std::index_sequence.
+ *
+ * @code{.unparsed}
+ * reverse_index_sequence_t<s> = std::index_sequence<s_(N-1), ..., s_1, s_0>
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Seq is not an std::index_sequence.
+ *
+ * @tparam  Seq     Input sequence.
+ */
+template<class Seq>
+using reverse_index_sequence_t = typename detail::reverse_index_impl<Seq>::type;
+
+/** Rotate the elements in an std::index_sequence to the left.
+ *
+ * @code{.unparsed}
+ * rotate_index_sequence_t<K, s> = std::index_sequence<s_K, ..., s_(N-1), s_0, ..., s_(K-1)>
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Seq is not an std::index_sequence.
+ *
+ * @tparam  Shift   Number of elements to rotate by (modulo the length).
+ * @tparam  Seq     Input sequence.
+ */
+template<std::size_t Shift, class Seq>
+using rotate_index_sequence_t = typename detail::rotate_index_impl<Shift, Seq>::type;
+
+/** Concatenate two std::index_sequences.
+ *
+ * @code{.unparsed}
+ * concat_index_sequence_t<s, r> = std::index_sequence<s_0, ..., s_(N-1), r_0, ..., r_(M-1)>
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Lhs or @p Rhs is not an std::index_sequence.
+ *
+ * @tparam  Lhs     Left input sequence.
+ * @tparam  Rhs     Right input sequence.
+ */
+template<class Lhs, class Rhs>
+using concat_index_sequence_t = typename detail::concat_index_impl<Lhs, Rhs>::type;
+
+/** Interleave the elements of two std::index_sequences.
+ *
+ * The excess elements of the longer sequence are appended.
+ *
+ * @code{.unparsed}
+ * interleave_index_sequence_t<s, r> = std::index_sequence<s_0, r_0, s_1, r_1, ...>
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Lhs or @p Rhs is not an std::index_sequence.
+ *
+ * @tparam  Lhs     Left input sequence.
+ * @tparam  Rhs     Right input sequence.
+ */
+template<class Lhs, class Rhs>
+using interleave_index_sequence_t = typename detail::interleave_index_impl<Lhs, Rhs>::type;
+
+/** Keep the elements of an std::index_sequence for which a mask is set.
+ *
+ * @code{.unparsed}
+ * filter_index_sequence_t<s, m> = std::index_sequence<s_i_0, s_i_1, ..., s_i_(K-1)>
+ *
+ *      where i_0 < i_1 < ... < i_(K-1) are the indices with m_i = true
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Seq is not an std::index_sequence, or when @p Mask is
+ *          not a std::integer_sequence of bool with the same length.
+ *
+ * @tparam  Seq     Input sequence.
+ * @tparam  Mask    Mask sequence.
+ */
+template<class Seq, class Mask>
+using filter_index_sequence_t = typename detail::filter_index_impl<Seq, Mask>::type;
+
 } } // namespace fxx::meta
 
 #endif
@@ -176,8 +466,24 @@ using make_index_range = shift_index_sequence_t<Start, std::make_index_sequence<
 
 #ifdef FXX_TEST_STATIC
 
+#include <type_traits>
+// std::(integral_constant, is_same_v)
+
 namespace fxx { namespace meta {
 
+namespace detail {
+
+template<std::size_t N>
+using indices_h_twice = std::integral_constant<std::size_t, 2 * N>;
+
+// Rotated index array with static storage duration, for index_sequence_from_t.
+static constexpr auto indices_h_rotated = index_rotate(
+    index_array(std::make_index_sequence<3>{}),
+    2
+);
+
+} // namespace detail
+
 // apply_index_sequence_t
 static_assert(
     std::is_same_v<
@@ -195,6 +501,13 @@ static_assert(
 );
 
 // map_index_sequence_t
+static_assert(
+    std::is_same_v<
+        std::index_sequence<2, 4>,
+        map_index_sequence_t<detail::indices_h_twice, std::index_sequence<1, 2>>
+    >,
+    "fxx::meta::map_index_sequence_t: Regular case"
+);
 
 // shift_index_sequence_t
 static_assert(
@@ -238,6 +551,78 @@ static_assert(
     "fxx::meta::make_index_range: Regular case"
 );
 
+// index_sequence_from_t
+static_assert(
+    std::is_same_v<
+        std::index_sequence<2, 0, 1>,
+        index_sequence_from_t<detail::indices_h_rotated>
+    >,
+    "fxx::meta::index_sequence_from_t: Regular case"
+);
+
+// reverse_index_sequence_t
+static_assert(
+    std::is_same_v<std::index_sequence<>, reverse_index_sequence_t<std::index_sequence<>>>,
+    "fxx::meta::reverse_index_sequence_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::index_sequence<4, 9, 3, 1>,
+        reverse_index_sequence_t<std::index_sequence<1, 3, 9, 4>>
+    >,
+    "fxx::meta::reverse_index_sequence_t: Regular case"
+);
+
+// rotate_index_sequence_t
+static_assert(
+    std::is_same_v<std::index_sequence<>, rotate_index_sequence_t<1, std::index_sequence<>>>,
+    "fxx::meta::rotate_index_sequence_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::index_sequence<9, 4, 1, 3>,
+        rotate_index_sequence_t<6, std::index_sequence<1, 3, 9, 4>>
+    >,
+    "fxx::meta::rotate_index_sequence_t: Regular case"
+);
+
+// concat_index_sequence_t
+static_assert(
+    std::is_same_v<
+        std::index_sequence<1, 3, 0>,
+        concat_index_sequence_t<std::index_sequence<1, 3>, std::index_sequence<0>>
+    >,
+    "fxx::meta::concat_index_sequence_t: Regular case"
+);
+
+// interleave_index_sequence_t
+static_assert(
+    std::is_same_v<
+        std::index_sequence<1, 0, 3, 2, 4>,
+        interleave_index_sequence_t<std::index_sequence<1, 3>, std::index_sequence<0, 2, 4>>
+    >,
+    "fxx::meta::interleave_index_sequence_t: Regular case"
+);
+
+// filter_index_sequence_t
+static_assert(
+    std::is_same_v<
+        std::index_sequence<>,
+        filter_index_sequence_t<std::index_sequence<>, std::integer_sequence<bool>>
+    >,
+    "fxx::meta::filter_index_sequence_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::index_sequence<3, 4>,
+        filter_index_sequence_t<
+            std::index_sequence<1, 3, 9, 4>,
+            std::integer_sequence<bool, false, true, false, true>
+        >
+    >,
+    "fxx::meta::filter_index_sequence_t: Regular case"
+);
+
 } } // namespace fxx::meta
 
 #endif
\ No newline at end of file
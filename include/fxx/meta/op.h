@@ -1,6 +1,8 @@
 /** Traits for all C++ operators.
  *
- * Using the detection idiom, provides traits for all C++ operator types.
+ * Using the detection idiom, provides traits for all C++ operator types. When compiling as C++20,
+ * the traits are detected through requires-expressions instead of std::void_t, which are also
+ * published as concepts (e.g. `has_op_plus<Lhs, Rhs>` for `op_plus<Lhs, Rhs>`).
  *
  * @file        meta/op.h
  * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
@@ -23,18 +25,44 @@
 #include <tuple>
 // std::(tuple_element_t, tuple_size_v)
 #include <type_traits>
-// std::conjunction
+// std::(is_convertible_v, void_t)
 #include <utility>
 // std::declval
 
+#if __cplusplus > 201703L
+// C++20
+
+// Declares the concept that detects an operator.
+#define FXX_META_OP_CONCEPT(name, params, ...)                                                     \
+template<FXX_META_OP_UNPACK params>                                                                \
+concept name = requires { __VA_ARGS__; };
+// Constrains the operator_info specialization of a trait by its concept.
+#define FXX_META_OP_REQUIRES(...) requires __VA_ARGS__
+#define FXX_META_OP_ENABLE(...) void
+
+#else
+// C++17
+
+#define FXX_META_OP_CONCEPT(name, params, ...)
+#define FXX_META_OP_REQUIRES(...)
+// Enables the operator_info specialization of a trait by SFINAE.
+#define FXX_META_OP_ENABLE(...) std::void_t<__VA_ARGS__>
+
+#endif
+
+// Removes the parentheses around a template parameter list.
+#define FXX_META_OP_UNPACK(...) __VA_ARGS__
+
 // Helper for defining a left-sided unary operator.
 #define FXX_META_OP_UNOP_T(name, op)                                                               \
 template<class Rhs>                                                                                \
 using name ## _t = decltype(op std::declval<Rhs>());                                               \
+FXX_META_OP_CONCEPT(has_op_ ## name, (class Rhs), op std::declval<Rhs>())                          \
 template<class Rhs, class Enable = void>                                                           \
 struct op_ ## name : operator_base<Rhs> {};                                                        \
 template<class Rhs>                                                                                \
-struct op_ ## name <Rhs, std::void_t<name ## _t<Rhs>>>                                             \
+FXX_META_OP_REQUIRES(has_op_ ## name<Rhs>)                                                         \
+struct op_ ## name <Rhs, FXX_META_OP_ENABLE(name ## _t<Rhs>)>                                      \
 : operator_info<name ## _t<Rhs>, Rhs> {                                                            \
     static constexpr bool is_nothrow = noexcept(op std::declval<Rhs>());                           \
     constexpr auto operator()(Rhs&& rhs) noexcept(is_nothrow)                                      \
@@ -45,10 +73,12 @@ struct op_ ## name <Rhs, std::void_t<name ## _t<Rhs>>>
 #define FXX_META_OP_UNOP2_T(name, op)                                                              \
 template<class Lhs>                                                                                \
 using name ## _t = decltype(std::declval<Lhs>() op);                                               \
+FXX_META_OP_CONCEPT(has_op_ ## name, (class Lhs), std::declval<Lhs>() op)                          \
 template<class Lhs, class Enable = void>                                                           \
 struct op_ ## name : operator_base<Lhs> {};                                                        \
 template<class Lhs>                                                                                \
-struct op_ ## name <Lhs, std::void_t<name ## _t<Lhs>>>                                             \
+FXX_META_OP_REQUIRES(has_op_ ## name<Lhs>)                                                         \
+struct op_ ## name <Lhs, FXX_META_OP_ENABLE(name ## _t<Lhs>)>                                      \
 : operator_info<name ## _t<Lhs>, Lhs> {                                                            \
     static constexpr bool is_nothrow = noexcept(std::declval<Lhs>() op);                           \
     constexpr auto operator()(Lhs&& lhs) noexcept(is_nothrow)                                      \
@@ -59,10 +89,16 @@ struct op_ ## name <Lhs, std::void_t<name ## _t<Lhs>>>
 #define FXX_META_OP_BINOP_T(name, op)                                                              \
 template<class Lhs, class Rhs = Lhs>                                                               \
 using name ## _t = decltype(std::declval<Lhs>() op std::declval<Rhs>());                           \
+FXX_META_OP_CONCEPT(                                                                               \
+    has_op_ ## name,                                                                               \
+    (class Lhs, class Rhs = Lhs),                                                                  \
+    std::declval<Lhs>() op std::declval<Rhs>()                                                     \
+)                                                                                                  \
 template<class Lhs, class Rhs = Lhs, class Enable = void>                                          \
 struct op_ ## name : operator_base<Lhs, Rhs> {};                                                   \
 template<class Lhs, class Rhs>                                                                     \
-struct op_ ## name <Lhs, Rhs, std::void_t<name ## _t<Lhs, Rhs>>>                                   \
+FXX_META_OP_REQUIRES(has_op_ ## name<Lhs, Rhs>)                                                    \
+struct op_ ## name <Lhs, Rhs, FXX_META_OP_ENABLE(name ## _t<Lhs, Rhs>)>                            \
 : operator_info<name ## _t<Lhs, Rhs>, Lhs, Rhs> {                                                  \
     static constexpr bool is_nothrow = noexcept(std::declval<Lhs>() op std::declval<Rhs>());       \
     constexpr auto operator()(Lhs&& lhs, Rhs&& rhs) noexcept(is_nothrow)                           \
@@ -142,13 +178,20 @@ FXX_META_OP_UNOP_T(addr_of, &);
 template<class T, class Sub>
 using subscript_t = decltype(std::declval<T>()[std::declval<Sub>()]);
 
+FXX_META_OP_CONCEPT(
+    has_op_subscript,
+    (class T, class Sub),
+    std::declval<T>()[std::declval<Sub>()]
+)
+
 template<class T, class Sub, class Enable = void>
 struct op_subscript : operator_base<T, Sub> {
     using target_type = T;
     using index_type = Sub;
 };
 template<class T, class Sub>
-struct op_subscript <T, Sub, std::void_t<subscript_t<T, Sub>>>
+FXX_META_OP_REQUIRES(has_op_subscript<T, Sub>)
+struct op_subscript <T, Sub, FXX_META_OP_ENABLE(subscript_t<T, Sub>)>
 : operator_info<subscript_t<T, Sub>, T, Sub> {
     using target_type = T;
     using index_type = Sub;
@@ -162,6 +205,12 @@ struct op_subscript <T, Sub, std::void_t<subscript_t<T, Sub>>>
 template<class T, class... Args>
 using call_t = decltype(std::declval<T>()(std::declval<Args>()...));
 
+FXX_META_OP_CONCEPT(
+    has_op_call,
+    (class T, class... Args),
+    std::declval<T>()(std::declval<Args>()...)
+)
+
 namespace detail {
 
 template<class Ops, class Enable = void>
@@ -172,8 +221,9 @@ struct op_call_impl : apply_t<operator_base, Ops> {
 };
 
 template<class Target, class... Args>
-struct op_call_impl<std::tuple<Target, Args...>, call_t<Target, Args...>>
-: operator_info<op_call_impl<Target, Args...>, Target, Args...> {
+FXX_META_OP_REQUIRES(has_op_call<Target, Args...>)
+struct op_call_impl<std::tuple<Target, Args...>, FXX_META_OP_ENABLE(call_t<Target, Args...>)>
+: operator_info<call_t<Target, Args...>, Target, Args...> {
     using target_type = Target;
     using argument_types = std::tuple<Args...>;
     static constexpr std::size_t argument_count = sizeof...(Args);
@@ -190,4 +240,63 @@ using op_call = detail::op_call_impl<std::tuple<Target, Args...>, void>;
 
 } } // namespace fxx::meta
 
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// VERIFICATION USING STATIC ASSERTIONS
+//--------------------------------------------------------------------------------------------------
+
+#ifdef FXX_TEST_STATIC
+
+#include <string>
+// std::string
+#include <type_traits>
+// std::is_same_v
+
+namespace fxx_meta_op_h {
+
+struct no_ops {};
+
+static_assert(
+    fxx::meta::op_plus<int, long>::is_detected
+    && std::is_same_v<long, fxx::meta::op_plus<int, long>::result_type>
+    && !fxx::meta::op_plus<no_ops>::is_detected,
+    "fxx::meta::op_plus"
+);
+static_assert(
+    fxx::meta::op_inc<int&>::is_detected && !fxx::meta::op_inc<int>::is_detected,
+    "fxx::meta::op_inc"
+);
+static_assert(
+    fxx::meta::op_postinc<int&>::is_detected && !fxx::meta::op_postinc<no_ops&>::is_detected,
+    "fxx::meta::op_postinc"
+);
+static_assert(
+    fxx::meta::op_subscript<int*, int>::is_detected
+    && std::is_same_v<int&, fxx::meta::op_subscript<int*, int>::result_type>
+    && !fxx::meta::op_subscript<int, int>::is_detected,
+    "fxx::meta::op_subscript"
+);
+static_assert(
+    fxx::meta::op_call<int(*)(char), char>::is_detected
+    && std::is_same_v<int, fxx::meta::op_call<int(*)(char), char>::result_type>
+    && !fxx::meta::op_call<int(*)(char), no_ops>::is_detected,
+    "fxx::meta::op_call"
+);
+
+#if __cplusplus > 201703L
+static_assert(
+    fxx::meta::has_op_plus<std::string>
+    && fxx::meta::has_op_plus<std::string, const char*>
+    && !fxx::meta::has_op_plus<no_ops>,
+    "fxx::meta::has_op_plus"
+);
+static_assert(
+    fxx::meta::has_op_call<int(*)(char), char> && !fxx::meta::has_op_call<no_ops>,
+    "fxx::meta::has_op_call"
+);
+#endif
+
+} // namespace fxx_meta_op_h
+
 #endif
\ No newline at end of file
@@ -8,34 +8,57 @@
  * @code{.unparsed}
  * Declaring:
  *
- *     make_tuple_t ... Turn a variadic parameter pack into a std::tuple type.
+ *         make_tuple_t ... Turn a variadic parameter pack into a std::tuple type.
  *
  * Consuming:
  *
- *          apply_t ... Forward std::tuple types as variadic arguments to another template.
- *    apply_partial ... Forward std::tuple types as partial variadic arguments to another template.
+ *              apply_t ... Forward std::tuple types as variadic arguments to another template.
+ *        apply_partial ... Partially forward std::tuple types as variadic arguments to a template.
  *
  * Reasoning:
  *
- *            first ... Find the first type matching a predicate in a std::tuple.
- *             find ... Find the first appearance of a type in a std::tuple.
+ *                first ... Find the first type matching a predicate in a std::tuple.
+ *                 find ... Find the first appearance of a type in a std::tuple.
+ *       tuple_contains ... Indicate whether a type appears in a std::tuple.
+ *       tuple_index_of ... Get the index of the first appearance of a type in a std::tuple.
+ *
+ * Accessing:
+ *
+ *            type_at_t ... Get the element type at an index of a std::tuple.
+ *           types_at_t ... Get the element types at a list of indices of a std::tuple.
  *
  * Restructuring:
  *
- *      tuple_cat_t ... Concatenate std::tuple types.
- *     tuple_flip_t ... Flip (reverse the order of) a std::tuple type.
- *     tuple_pick_t ... Pick (select elements) from a std::tuple type.
- *      tuple_dup_t ... Duplicate (and concatenate) a std::tuple type.
- *     tuple_skip_t ... Skip elements in a std::tuple type.
- *     tuple_take_t ... Take elements from a std::tuple type.
- *    tuple_slice_t ... Obtain a sub-range from a std::tuple type.
+ *          tuple_cat_t ... Concatenate std::tuple types.
+ *         tuple_flip_t ... Flip (reverse the order of) a std::tuple type.
+ *         tuple_pick_t ... Pick (select elements) from a std::tuple type.
+ *          tuple_dup_t ... Duplicate (and concatenate) a std::tuple type.
+ *         tuple_skip_t ... Skip elements in a std::tuple type.
+ *         tuple_take_t ... Take elements from a std::tuple type.
+ *        tuple_slice_t ... Obtain a sub-range from a std::tuple type.
  *
  * Transforming:
  *
- *      tuple_map_t ... Map all elements of a std::tuple type.
- *   tuple_reduce_t ... Reduce a std::tuple type.
- *     tuple_fold_t ... Fold a std::tuple type from the left.
- *   tuple_filter_t ... Filter a std::tuple based on type.
+ *          tuple_map_t ... Map all elements of a std::tuple type.
+ *       tuple_reduce_t ... Reduce a std::tuple type.
+ *  tuple_reduce_tree_t ... Reduce a std::tuple type in a balanced tree.
+ *         tuple_fold_t ... Fold a std::tuple type from the left.
+ *    tuple_fold_tree_t ... Fold a std::tuple type in a balanced tree.
+ *       tuple_filter_t ... Filter a std::tuple based on type.
+ *   tuple_filter_seq_t ... Get the indices kept by filtering a std::tuple based on type.
+ *
+ * Ordering:
+ *
+ * tuple_sort_indices_t ... Get the stable sorting permutation of a std::tuple type.
+ *         tuple_sort_t ... Stably sort a std::tuple type by a key.
+ *
+ * Sets:
+ *
+ *   tuple_unique_seq_t ... Get the indices of the first appearances of the types in a std::tuple.
+ *       tuple_unique_t ... Remove duplicate types from a std::tuple type.
+ *        tuple_union_t ... Get the set union of std::tuple types.
+ * tuple_intersection_t ... Get the set intersection of std::tuple types.
+ *   tuple_difference_t ... Get the set difference of std::tuple types.
  * @endcode
  *
  * @file        meta/tuple.h
@@ -53,12 +76,18 @@
 #pragma once
 
 #include <fxx/meta/functional.h>
-// fxx::meta::(tautology, partial_t)
+// fxx::meta::tautology
+#include <fxx/meta/indices.h>
+// fxx::meta::(make_index_range, reverse_index_sequence_t)
 
+#include <functional>
+// std::less
 #include <tuple>
-// std::(tuple, tuple_element_t)
+// std::(tuple, tuple_size_v)
 #include <type_traits>
-// std::(bool_constant, conditional_t, is_same)
+// std::(bool_constant, conditional_t, decay_t, disjunction, integral_constant)
+#include <utility>
+// std::(index_sequence, index_sequence_for, make_index_sequence)
 
 #include <cstddef>
 // std::size_t
@@ -101,139 +130,164 @@ struct first_impl<Pred, Offset, std::tuple<Head, Tail...>>
 > {};
 
 // Dispatch case.
-template<class...>
-struct tuple_cat_impl {};
+template<template<class> class, std::size_t, class>
+struct first_block_impl {};
 
-// Abort case.
-template<>
-struct tuple_cat_impl<> {
-    using type = std::tuple<>;
-};
+// Recursive case, which is only used on a block that is known to contain a match.
+template<template<class> class Pred, std::size_t Offset, class Head, class... Tail>
+struct first_block_impl<Pred, Offset, std::tuple<Head, Tail...>>
+: std::conditional_t<
+    Pred<Head>::value,
+    index_helper<true, Offset>,
+    first_block_impl<Pred, Offset + 1, std::tuple<Tail...>>
+> {};
 
-// Abort case.
-template<class... Ts>
-struct tuple_cat_impl<std::tuple<Ts...>> {
-    using type = std::tuple<Ts...>;
-};
+// Block case, which tests 8 predicates at a time to bound the recursion depth to N / 8. The
+// std::disjunction stops at the first match, which is then located inside the block.
+template<
+    template<class> class Pred,
+    std::size_t Offset,
+    class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7,
+    class... Tail
+>
+struct first_impl<Pred, Offset, std::tuple<A0, A1, A2, A3, A4, A5, A6, A7, Tail...>>
+: std::conditional_t<
+    std::disjunction<
+        Pred<A0>, Pred<A1>, Pred<A2>, Pred<A3>, Pred<A4>, Pred<A5>, Pred<A6>, Pred<A7>
+    >::value,
+    first_block_impl<Pred, Offset, std::tuple<A0, A1, A2, A3, A4, A5, A6, A7>>,
+    first_impl<Pred, Offset + 8, std::tuple<Tail...>>
+> {};
 
-// Recursive case.
-template<class... Ls, class... Rs, class... Rest>
-struct tuple_cat_impl<std::tuple<Ls...>, std::tuple<Rs...>, Rest...> {
-    using type = typename tuple_cat_impl<std::tuple<Ls..., Rs...>, Rest...>::type;
+// Leaf type binding a type to an index.
+template<std::size_t I, class T>
+struct indexed_leaf {
+    using type = T;
 };
 
 // Dispatch case.
-template<class Tuple>
-struct tuple_flip_impl {};
+template<class, class...>
+struct indexed_set_impl {};
 
-// Recursive case.
-template<class Head, class... Ts>
-struct tuple_flip_impl<std::tuple<Head, Ts...>> {
-    using prefix = typename tuple_flip_impl<std::tuple<Ts...>>::type;
-    using type = typename tuple_cat_impl<prefix, std::tuple<Head>>::type;
-};
+// Variadic case.
+template<std::size_t... Is, class... Ts>
+struct indexed_set_impl<std::index_sequence<Is...>, Ts...> : indexed_leaf<Is, Ts>... {};
 
-// Abort case.
-template<>
-struct tuple_flip_impl<std::tuple<>> {
-    using type = std::tuple<>;
-};
+// Flat set of indexed leafs, which allows constant depth lookup by index.
+template<class... Ts>
+using indexed_set = indexed_set_impl<std::index_sequence_for<Ts...>, Ts...>;
+
+// Selects a leaf by index through overload resolution on the derived-to-base conversion.
+template<std::size_t I, class T>
+indexed_leaf<I, T> indexed_select(const indexed_leaf<I, T>*);
+
+// Get the type at an index in an indexed_set without recursion.
+template<std::size_t I, class Set>
+using indexed_at_t = typename decltype(indexed_select<I>(static_cast<Set*>(nullptr)))::type;
 
 // Dispatch case.
-template<class Tuple, std::size_t... Ns>
-struct tuple_pick_impl {};
+template<class>
+struct tuple_indexed_set {};
 
-// Recursive case.
-template<class Tuple, std::size_t Head, std::size_t... Tail>
-struct tuple_pick_impl<Tuple, Head, Tail...> {
-    using suffix = typename tuple_pick_impl<Tuple, Tail...>::type;
-    using type = typename tuple_cat_impl<
-        std::tuple<std::tuple_element_t<Head, Tuple>>,
-        suffix
-    >::type;
+// Variadic case.
+template<class... Ts>
+struct tuple_indexed_set<std::tuple<Ts...>> {
+    static constexpr std::size_t size = sizeof...(Ts);
+    using type = indexed_set<Ts...>;
 };
 
-// Abort case.
-template<class Tuple>
-struct tuple_pick_impl<Tuple> {
-    using type = std::tuple<>;
+// Maps every output index of a concatenation to the (tuple, element) index pair it stems from.
+template<std::size_t N>
+struct tuple_cat_table {
+    std::size_t outer[N + 1];
+    std::size_t inner[N + 1];
 };
 
-// Recursive case.
-template<std::size_t N, class Tuple>
-struct tuple_dup_impl {
-    using suffix = typename tuple_dup_impl<N-1, Tuple>::type;
-    using type = typename tuple_cat_impl<Tuple, suffix>::type;
-};
+template<std::size_t... Sizes>
+constexpr auto make_tuple_cat_table() {
+    constexpr std::size_t sizes[] = {Sizes..., 0};
+    tuple_cat_table<(std::size_t{0} + ... + Sizes)> table{};
 
-// Abort case.
-template<class Tuple>
-struct tuple_dup_impl<0, Tuple> {
-    using type = std::tuple<>;
-};
+    std::size_t n = 0;
+    for (std::size_t t = 0; t < sizeof...(Sizes); ++t) {
+        for (std::size_t e = 0; e < sizes[t]; ++e, ++n) {
+            table.outer[n] = t;
+            table.inner[n] = e;
+        }
+    }
+
+    return table;
+}
 
 // Dispatch case.
-template<class>
-struct tuple_skip_one {};
+template<class, class...>
+struct tuple_cat_flat {};
 
 // Variadic case.
-template<class Head, class... Tail>
-struct tuple_skip_one<std::tuple<Head, Tail...>> {
-    using type = std::tuple<Tail...>;
+template<std::size_t... Ns, class... Tuples>
+struct tuple_cat_flat<std::index_sequence<Ns...>, Tuples...> {
+    static constexpr auto table = make_tuple_cat_table<tuple_indexed_set<Tuples>::size...>();
+    using tuples = indexed_set<typename tuple_indexed_set<Tuples>::type...>;
+    using type = std::tuple<
+        indexed_at_t<table.inner[Ns], indexed_at_t<table.outer[Ns], tuples>>...
+    >;
 };
 
-// Fallback case.
-/*
-template<>
-struct tuple_skip_one<std::tuple<>> {
-    using type = std::tuple<>;
-};
-*/
+// Flat case.
+template<class... Tuples>
+struct tuple_cat_impl : tuple_cat_flat<
+    std::make_index_sequence<(std::size_t{0} + ... + tuple_indexed_set<Tuples>::size)>,
+    Tuples...
+> {};
 
-// Recursive case.
-template<std::size_t N, class Tuple>
-struct tuple_skip_impl {
-    using prefix = typename tuple_skip_one<Tuple>::type;
-    using type = typename tuple_skip_impl<N-1, prefix>::type;
+// Dispatch case.
+template<class, class>
+struct tuple_select_impl {};
+
+// Variadic case.
+template<class... Ts, std::size_t... Ns>
+struct tuple_select_impl<std::tuple<Ts...>, std::index_sequence<Ns...>> {
+    using set = typename tuple_indexed_set<std::tuple<Ts...>>::type;
+    using type = std::tuple<indexed_at_t<Ns, set>...>;
 };
 
-// Abort case.
+// Flat case.
 template<class Tuple>
-struct tuple_skip_impl<0, Tuple> {
-    using type = Tuple;
+struct tuple_flip_impl : tuple_select_impl<
+    Tuple,
+    reverse_index_sequence_t<std::make_index_sequence<std::tuple_size_v<Tuple>>>
+> {};
+
+// Repeats a type once per index.
+template<std::size_t, class T>
+struct tuple_dup_repeat {
+    using type = T;
 };
 
 // Dispatch case.
-template<class>
-struct tuple_take_one {};
+template<class, class>
+struct tuple_dup_flat {};
 
 // Variadic case.
-template<class Head, class... Tail>
-struct tuple_take_one<std::tuple<Head, Tail...>> {
-    using type = std::tuple<Head>;
+template<std::size_t... Ns, class Tuple>
+struct tuple_dup_flat<std::index_sequence<Ns...>, Tuple> {
+    using type = typename tuple_cat_impl<typename tuple_dup_repeat<Ns, Tuple>::type...>::type;
 };
 
-// Fallback case.
-/*
-template<>
-struct tuple_take_one<std::tuple<>> {
-    using type = std::tuple<>;
-};
-*/
+// Flat case.
+template<std::size_t N, class Tuple>
+struct tuple_dup_impl : tuple_dup_flat<std::make_index_sequence<N>, Tuple> {};
 
-// Recursive case.
+// Flat case.
 template<std::size_t N, class Tuple>
-struct tuple_take_impl {
-    using prefix = typename tuple_take_one<Tuple>::type;
-    using suffix = typename tuple_skip_one<Tuple>::type;
-    using type = typename tuple_cat_impl<prefix, typename tuple_take_impl<N-1, suffix>::type>::type;
-};
+struct tuple_skip_impl : tuple_select_impl<
+    Tuple,
+    make_index_range<N, std::tuple_size_v<Tuple> - N>
+> {};
 
-// Abort case.
-template<class Tuple>
-struct tuple_take_impl<0, Tuple> {
-    using type = std::tuple<>;
-};
+// Flat case.
+template<std::size_t N, class Tuple>
+struct tuple_take_impl : tuple_select_impl<Tuple, std::make_index_sequence<N>> {};
 
 // Dispatch case.
 template<template<class> class, class>
@@ -249,28 +303,256 @@ struct tuple_map_impl<Fn, std::tuple<Ts...>> {
 template<template<class, class> class Fn, std::size_t N, class Tuple>
 struct tuple_reduce_impl {
     using pred = typename tuple_reduce_impl<Fn, N-1, Tuple>::type;
-    using type = Fn<pred, std::tuple_element_t<N-1, Tuple>>;
+    using set = typename tuple_indexed_set<Tuple>::type;
+    using type = Fn<pred, indexed_at_t<N-1, set>>;
 };
 
 // Abort case.
 template<template<class, class> class Fn, class Tuple>
 struct tuple_reduce_impl<Fn, 1, Tuple> {
-    using type = std::tuple_element_t<0, Tuple>;
+    using set = typename tuple_indexed_set<Tuple>::type;
+    using type = indexed_at_t<0, set>;
 };
 
-// Recursion case.
-template<template<class> class Pred, std::size_t N, class Tuple>
-struct tuple_filter_impl {
-    using pred = typename tuple_filter_impl<Pred, N-1, Tuple>::type;
-    using cur = std::tuple_element_t<N-1, Tuple>;
-    using flt = std::conditional_t<Pred<cur>::value, std::tuple<cur>, std::tuple<>>;
-    using type = typename tuple_cat_impl<pred, flt>::type;
+// Recursive case.
+template<template<class, class> class Fn, std::size_t Start, std::size_t Length, class Tuple>
+struct tuple_reduce_tree_impl {
+    using lhs = typename tuple_reduce_tree_impl<Fn, Start, Length / 2, Tuple>::type;
+    using rhs = typename tuple_reduce_tree_impl<
+        Fn,
+        Start + Length / 2,
+        Length - Length / 2,
+        Tuple
+    >::type;
+    using type = Fn<lhs, rhs>;
 };
 
 // Abort case.
+template<template<class, class> class Fn, std::size_t Start, class Tuple>
+struct tuple_reduce_tree_impl<Fn, Start, 1, Tuple> {
+    using set = typename tuple_indexed_set<Tuple>::type;
+    using type = indexed_at_t<Start, set>;
+};
+
+// Lists the indices of the kept elements of a filter.
+template<std::size_t N>
+struct tuple_filter_table {
+    std::size_t size;
+    std::size_t index[N + 1];
+};
+
+template<bool... Keep>
+constexpr auto make_tuple_filter_table() {
+    constexpr bool keep[] = {Keep..., false};
+    tuple_filter_table<sizeof...(Keep)> table{};
+
+    for (std::size_t i = 0; i < sizeof...(Keep); ++i) {
+        if (keep[i]) {
+            table.index[table.size++] = i;
+        }
+    }
+
+    return table;
+}
+
+// Recursive case.
+template<
+    template<class, class> class Fn,
+    class Init,
+    class Tuple,
+    std::size_t N = std::tuple_size_v<Tuple>
+>
+struct tuple_fold_tree_impl {
+    using type = Fn<Init, typename tuple_reduce_tree_impl<Fn, 0, N, Tuple>::type>;
+};
+
+// Abort case.
+template<template<class, class> class Fn, class Init, class Tuple>
+struct tuple_fold_tree_impl<Fn, Init, Tuple, 0> {
+    using type = Init;
+};
+
+// Dispatch case.
+template<template<class> class, class>
+struct tuple_filter_seq_impl {};
+
+// Flat case.
+template<template<class> class Pred, class... Ts>
+struct tuple_filter_seq_impl<Pred, std::tuple<Ts...>> {
+    static constexpr auto table = make_tuple_filter_table<Pred<Ts>::value...>();
+
+    template<std::size_t... Ks>
+    static auto select(std::index_sequence<Ks...>) -> std::index_sequence<table.index[Ks]...>;
+
+    using type = decltype(select(std::make_index_sequence<table.size>{}));
+};
+
+// Flat case.
 template<template<class> class Pred, class Tuple>
-struct tuple_filter_impl<Pred, 0, Tuple> {
-    using type = std::tuple<>;
+struct tuple_filter_impl : tuple_select_impl<
+    Tuple,
+    typename tuple_filter_seq_impl<Pred, Tuple>::type
+> {};
+
+// Lists the indices of the elements in sorted order.
+template<std::size_t N>
+struct tuple_sort_table {
+    std::size_t index[N];
+};
+
+// Stable bottom-up merge sort of the indices of a key array.
+template<class Compare, class Key, std::size_t N>
+constexpr auto make_tuple_sort_table(const Key (&keys)[N]) {
+    tuple_sort_table<N> table{};
+    std::size_t buffer[N]{};
+
+    for (std::size_t i = 0; i < N; ++i) {
+        table.index[i] = i;
+    }
+
+    for (std::size_t width = 1; width < N; width *= 2) {
+        for (std::size_t lo = 0; lo < N; lo += 2 * width) {
+            const std::size_t mid = lo + width < N ? lo + width : N;
+            const std::size_t hi = lo + 2 * width < N ? lo + 2 * width : N;
+
+            std::size_t i = lo, j = mid, k = lo;
+            while (i < mid && j < hi) {
+                // Only take from the right run when strictly ordered before, to remain stable.
+                buffer[k++] = Compare{}(keys[table.index[j]], keys[table.index[i]])
+                    ? table.index[j++]
+                    : table.index[i++];
+            }
+            while (i < mid) buffer[k++] = table.index[i++];
+            while (j < hi) buffer[k++] = table.index[j++];
+        }
+
+        for (std::size_t i = 0; i < N; ++i) {
+            table.index[i] = buffer[i];
+        }
+    }
+
+    return table;
+}
+
+// Dispatch case.
+template<template<class> class, class, class>
+struct tuple_sort_seq_impl {};
+
+// Trivial case.
+template<template<class> class Key, class Compare>
+struct tuple_sort_seq_impl<Key, Compare, std::tuple<>> {
+    using type = std::index_sequence<>;
+};
+
+// Flat case.
+template<template<class> class Key, class Compare, class Head, class... Tail>
+struct tuple_sort_seq_impl<Key, Compare, std::tuple<Head, Tail...>> {
+    // All keys are converted to the key type of the first element.
+    using key_type = std::decay_t<decltype(Key<Head>::value)>;
+
+    static constexpr key_type keys[] = {Key<Head>::value, Key<Tail>::value...};
+    static constexpr auto table = make_tuple_sort_table<Compare>(keys);
+
+    template<std::size_t... Ks>
+    static auto select(std::index_sequence<Ks...>) -> std::index_sequence<table.index[Ks]...>;
+
+    using type = decltype(select(std::make_index_sequence<1 + sizeof...(Tail)>{}));
+};
+
+// Unique address per type, which allows comparing types in constant expressions.
+template<class T>
+struct type_id {
+    static constexpr char tag = 0;
+};
+
+template<class... Ts>
+constexpr auto make_tuple_unique_table() {
+    constexpr const char* ids[] = {&type_id<Ts>::tag..., nullptr};
+    tuple_filter_table<sizeof...(Ts)> table{};
+
+    for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+        bool first = true;
+        for (std::size_t j = 0; first && j < i; ++j) {
+            first = ids[j] != ids[i];
+        }
+
+        if (first) {
+            table.index[table.size++] = i;
+        }
+    }
+
+    return table;
+}
+
+// Dispatch case.
+template<class>
+struct tuple_unique_seq_impl {};
+
+// Flat case.
+template<class... Ts>
+struct tuple_unique_seq_impl<std::tuple<Ts...>> {
+    static constexpr auto table = make_tuple_unique_table<Ts...>();
+
+    template<std::size_t... Ks>
+    static auto select(std::index_sequence<Ks...>) -> std::index_sequence<table.index[Ks]...>;
+
+    using type = decltype(select(std::make_index_sequence<table.size>{}));
+};
+
+// Leaf type binding a type to the index of its first occurrence.
+template<class T, std::size_t I>
+struct type_set_leaf {};
+
+// Flat set of distinct type leafs, which allows constant depth lookup by type.
+template<class... Leafs>
+struct type_set : Leafs... {};
+
+// Selects the leaf of a contained type through overload resolution on the derived-to-base
+// conversion.
+template<class T, std::size_t N, std::size_t I>
+std::integral_constant<std::size_t, I> type_set_select(const type_set_leaf<T, I>*);
+
+// Selects the size of the tuple for absent types.
+template<class T, std::size_t N>
+std::integral_constant<std::size_t, N> type_set_select(const void*);
+
+// Dispatch case.
+template<class Tuple, class = typename tuple_unique_seq_impl<Tuple>::type>
+struct tuple_type_set {};
+
+// Flat case.
+template<class... Ts, std::size_t... Ks>
+struct tuple_type_set<std::tuple<Ts...>, std::index_sequence<Ks...>> {
+    using type = type_set<type_set_leaf<indexed_at_t<Ks, indexed_set<Ts...>>, Ks>...>;
+
+    template<class T>
+    using index_of = decltype(type_set_select<T, sizeof...(Ts)>(static_cast<type*>(nullptr)));
+};
+
+template<class T, class Tuple>
+using tuple_index_of_impl = typename tuple_type_set<Tuple>::template index_of<T>;
+
+template<class T, class Tuple>
+struct tuple_contains_impl
+: std::bool_constant<tuple_index_of_impl<T, Tuple>::value != std::tuple_size_v<Tuple>> {};
+
+// Dispatch case.
+template<class, class, bool>
+struct tuple_set_filter_impl {};
+
+// Flat case, which keeps the elements whose membership in Other equals Keep.
+template<class... Ts, class Other, bool Keep>
+struct tuple_set_filter_impl<std::tuple<Ts...>, Other, Keep> {
+    static constexpr auto table = make_tuple_filter_table<
+        tuple_contains_impl<Ts, Other>::value == Keep...
+    >();
+
+    template<std::size_t... Ks>
+    static auto select(std::index_sequence<Ks...>) -> std::tuple<
+        indexed_at_t<table.index[Ks], indexed_set<Ts...>>...
+    >;
+
+    using type = decltype(select(std::make_index_sequence<table.size>{}));
 };
 
 } // namespace detail
@@ -341,7 +623,8 @@ struct apply_partial<Target, std::tuple<Ts...>> {
 /** Find the first type in a std::tuple that matches a predicate.
  *
  * The 0-tuple never contains any matches.
- * The tuple is searched left to right.
+ * The tuple is searched left to right, in blocks of 8 elements. Predicates are instantiated in
+ * order, and not at all after the first match. The instantiation depth grows with N / 8.
  * The index at which the first matching type was found will be returned in the ::index member of
  * the result type.
  *
@@ -371,7 +654,7 @@ using first = typename detail::first_impl<Pred, 0, Tuple>;
  * The index at which the type was found will be returned in the ::index member of the result type.
  *
  * @code{.unparsed}
- * find<x, t>::value <=> Ex. i el. [0, N): t_i = x; ::index = i
+ * find<x, t>::value <=> Ex. i el. [0, N): t_i = x; ::index = tuple_index_of<x, t>::value
  *
  *      where x is the matcher type.
  *        and t is the input tuple type
@@ -386,7 +669,109 @@ using first = typename detail::first_impl<Pred, 0, Tuple>;
  * @tparam  Tuple   Input tuple type.
  */
 template<class T, class Tuple>
-using find = first<partial<std::is_same, T>::template type, Tuple>;
+using find = detail::index_helper<
+    detail::tuple_contains_impl<T, Tuple>::value,
+    detail::tuple_index_of_impl<T, Tuple>::value
+>;
+
+/** Get a std::bool_constant indicating whether a type is contained in a std::tuple.
+ *
+ * Lookups go through a flat set of the distinct element types, which is instantiated once per
+ * tuple type and shared between all lookups. Every lookup thus has constant depth, and costs a
+ * single overload resolution.
+ *
+ * @code{.unparsed}
+ * tuple_contains<x, t>::value <=> Ex. i el. [0, N): t_i = x
+ *
+ *      where x is the matcher type
+ *        and t is the input tuple type
+ *        and t_i is the type of the i-th element
+ *        and N is the size of the input tuple type
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ *
+ * @tparam  T       Matcher type.
+ * @tparam  Tuple   Input tuple type.
+ */
+template<class T, class Tuple>
+using tuple_contains = detail::tuple_contains_impl<T, Tuple>;
+
+/** Indicates whether a type is contained in a std::tuple. See tuple_contains. */
+template<class T, class Tuple>
+static constexpr bool tuple_contains_v = tuple_contains<T, Tuple>::value;
+
+/** Get the index of the first occurrence of a type in a std::tuple.
+ *
+ * Uses the same shared type set as tuple_contains. Absent types have the size of the tuple as their
+ * index.
+ *
+ * @code{.unparsed}
+ * tuple_index_of<x, t>::value = min({i el. [0, N): t_i = x} u {N})
+ *
+ *      where x is the matcher type
+ *        and t is the input tuple type
+ *        and t_i is the type of the i-th element
+ *        and N is the size of the input tuple type
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ *
+ * @tparam  T       Matcher type.
+ * @tparam  Tuple   Input tuple type.
+ */
+template<class T, class Tuple>
+using tuple_index_of = detail::tuple_index_of_impl<T, Tuple>;
+
+/** Index of the first occurrence of a type in a std::tuple. See tuple_index_of. */
+template<class T, class Tuple>
+static constexpr std::size_t tuple_index_of_v = tuple_index_of<T, Tuple>::value;
+
+/** Get the type of an element in a std::tuple.
+ *
+ * @note    Mirrors std::tuple_element_t, but resolves in constant instantiation depth.
+ *
+ * All elements of @p Tuple are bound to their indices in a flat set of base classes, from which the
+ * requested one is selected by overload resolution. The set is shared between all lookups into the
+ * same tuple type, so K lookups into an N-tuple cost O(N + K) instantiations.
+ *
+ * @code{.unparsed}
+ * type_at_t<I, t> = t_I
+ *
+ *      where t is the input tuple type
+ *        and t_I is the type of the I-th element
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ * @warning Behavior is undefined when @p I is not a valid index for @p Tuple.
+ *
+ * @tparam  I       Element index.
+ * @tparam  Tuple   Input tuple type.
+ */
+template<std::size_t I, class Tuple>
+using type_at_t = detail::indexed_at_t<I, typename detail::tuple_indexed_set<Tuple>::type>;
+
+/** Get the types of a list of elements in a std::tuple.
+ *
+ * Performs a batch of type_at_t lookups that share a single indexed set.
+ *
+ * @code{.unparsed}
+ * types_at_t<t, i_0, i_1, ..., i_(N-1)> = std::tuple<t_(i_0), t_(i_1), ..., t_(i_(N-1))>
+ *
+ *      where t is the input tuple type
+ *        and i_j is the j-th input index
+ *        and N is the number of input indices
+ *        and t_k is the type of the k-th element
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ * @warning Behavior is undefined when @p Is contains invalid indexes for @p Tuple.
+ *
+ * @tparam  Tuple   Input tuple type.
+ * @tparam  Is      Element indices.
+ */
+template<class Tuple, std::size_t... Is>
+using types_at_t = typename detail::tuple_select_impl<Tuple, std::index_sequence<Is...>>::type;
 
 /** Get the result type of concatenating std::tuples.
  *
@@ -455,7 +840,7 @@ using tuple_flip_t = typename detail::tuple_flip_impl<Tuple>::type;
  * @tparam  Ns      Pick indices.
  */
 template<class Tuple, std::size_t... Ns>
-using tuple_pick_t = typename detail::tuple_pick_impl<Tuple, Ns...>::type;
+using tuple_pick_t = types_at_t<Tuple, Ns...>;
 
 /** Get the result type of duplicate-concatenating a std::tuple.
  *
@@ -540,7 +925,10 @@ using tuple_take_t = typename detail::tuple_take_impl<Take, Tuple>::type;
  * @tparam  Tuple   Input tuple type.
  */
 template<std::size_t Start, std::size_t Length, class Tuple>
-using tuple_slice_t = tuple_take_t<Length, tuple_skip_t<Start, Tuple>>;
+using tuple_slice_t = typename detail::tuple_select_impl<
+    Tuple,
+    make_index_range<Start, Length>
+>::type;
 
 /** Get the result type of mapping a std::tuple.
  *
@@ -588,6 +976,35 @@ using tuple_reduce_t = typename detail::tuple_reduce_impl<
     Tuple
 >::type;
 
+/** Get the result type of reducing a std::tuple in a balanced tree.
+ *
+ * Tree reduction is defined here as splitting the tuple into two halves, reducing both of them
+ * recursively, and combining the results. Reducing a 1-tuple results in its only element. The
+ * instantiation depth is logarithmic in the size of the tuple.
+ *
+ * @note    Only equivalent to tuple_reduce_t if @p Fn is associative.
+ *
+ * @code{.unparsed}
+ * tuple_reduce_tree_t<Fn, t> = Fn<Fn<Fn<t_0, t_1>, Fn<t_2, t_3>>, ...>
+ *
+ *      where t is the input tuple type
+ *        and the left half of every split has floor(M/2) of the M elements
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ * @warning Behavior is undefined when @p Tuple is the 0-tuple.
+ *
+ * @tparam  Fn      Reduction template.
+ * @tparam  Tuple   Input tuple type.
+ */
+template<template<class, class> class Fn, class Tuple>
+using tuple_reduce_tree_t = typename detail::tuple_reduce_tree_impl<
+    Fn,
+    0,
+    std::tuple_size_v<Tuple>,
+    Tuple
+>::type;
+
 /** Get the result type of left-folding a std::tuple.
  *
  * Left-folding is defined here as Haskell's foldl, meaning that a binary fold operation visits all
@@ -609,6 +1026,31 @@ using tuple_reduce_t = typename detail::tuple_reduce_impl<
 template<template<class, class> class Fn, class Init, class Tuple>
 using tuple_fold_t = tuple_reduce_t<Fn, tuple_cat_t<std::tuple<Init>, Tuple>>;
 
+/** Get the result type of folding a std::tuple in a balanced tree.
+ *
+ * Tree folding is defined here as combining the initial type with the tree reduction of the tuple
+ * (see tuple_reduce_tree_t). Folding the 0-tuple results in the initial type. The instantiation
+ * depth is logarithmic in the size of the tuple, so that large tuples stay within the default
+ * template depth limits.
+ *
+ * @note    Only equivalent to tuple_fold_t if @p Fn is associative.
+ * @note    Mirrors fxx::tuple::fold_tree.
+ *
+ * @code{.unparsed}
+ * tuple_fold_tree_t<Fn, I, t> = Fn<I, tuple_reduce_tree_t<Fn, t>>
+ *
+ *      where t is the input tuple type
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ *
+ * @tparam  Fn      Folding template.
+ * @tparam  Init    Initial type.
+ * @tparam  Tuple   Input tuple type.
+ */
+template<template<class, class> class Fn, class Init, class Tuple>
+using tuple_fold_tree_t = typename detail::tuple_fold_tree_impl<Fn, Init, Tuple>::type;
+
 /** Get the result type of filtering a std::tuple by type.
  *
  * Filtering by type is defined here as evaluating a Filter predicate for each element type and
@@ -632,10 +1074,167 @@ using tuple_fold_t = tuple_reduce_t<Fn, tuple_cat_t<std::tuple<Init>, Tuple>>;
  * @tparam  Tuple   Input tuple type.
  */
 template<template<class> class Pred, class Tuple>
-using tuple_filter_t = typename detail::tuple_filter_impl<
-    Pred,
-    std::tuple_size_v<Tuple>,
-    Tuple
+using tuple_filter_t = typename detail::tuple_filter_impl<Pred, Tuple>::type;
+
+/** Get the indices of the elements kept when filtering a std::tuple by type.
+ *
+ * The result is computed in a single expansion over the element types, and can be used to select
+ * the kept elements of a tuple value (see fxx::tuple::filter).
+ *
+ * @code{.unparsed}
+ * tuple_filter_seq_t<Pred, t> = std::index_sequence<i_0, i_1, ..., i_(K-1)>
+ *
+ *      where t is the input tuple type
+ *        and i_0 < i_1 < ... < i_(K-1) are the indices with Pred<t_i>::value
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Pred instances do not provide a
+ *          `static constexpr bool value`.
+ *
+ * @tparam  Pred    Predicate template.
+ * @tparam  Tuple   Input tuple type.
+ */
+template<template<class> class Pred, class Tuple>
+using tuple_filter_seq_t = typename detail::tuple_filter_seq_impl<Pred, Tuple>::type;
+
+/** Get the permutation that stably sorts a std::tuple type by a key.
+ *
+ * Sorting is defined here as ordering the element types by the compile-time key `Key<t_i>::value`
+ * using @p Compare, keeping elements with equivalent keys in their original order. The keys are
+ * instantiated once per element and ranked by a constexpr merge sort, so that the instantiation
+ * count is linear and the depth is constant. The result can be applied to a tuple type through
+ * apply_index_sequence_t and tuple_pick_t, or to a tuple value through fxx::tuple::pick_f.
+ *
+ * @code{.unparsed}
+ * tuple_sort_indices_t<Key, t, Compare> = std::index_sequence<p_0, p_1, ..., p_(N-1)>
+ *
+ *      where t is the input tuple type
+ *        and p is the stable permutation such that !Compare{}(k_(p_(j+1)), k_(p_j))
+ *        and k_i is Key<t_i>::value
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Key instances do not provide a `static constexpr value`
+ *          convertible to the key type of the first element, or when @p Compare is not a
+ *          constexpr strict weak ordering of those values.
+ *
+ * @tparam  Key     Key template.
+ * @tparam  Tuple   Input tuple type.
+ * @tparam  Compare Key comparison function type.
+ */
+template<template<class> class Key, class Tuple, class Compare = std::less<>>
+using tuple_sort_indices_t = typename detail::tuple_sort_seq_impl<Key, Compare, Tuple>::type;
+
+/** Get the result type of stably sorting a std::tuple type by a key.
+ *
+ * See tuple_sort_indices_t for more details.
+ *
+ * @code{.unparsed}
+ * tuple_sort_t<Key, t, Compare> = std::tuple<t_(p_0), t_(p_1), ..., t_(p_(N-1))>
+ *
+ *      where t is the input tuple type
+ *        and p is tuple_sort_indices_t<Key, t, Compare>
+ * @endcode
+ *
+ * @tparam  Key     Key template.
+ * @tparam  Tuple   Input tuple type.
+ * @tparam  Compare Key comparison function type.
+ */
+template<template<class> class Key, class Tuple, class Compare = std::less<>>
+using tuple_sort_t = typename detail::tuple_select_impl<
+    Tuple,
+    tuple_sort_indices_t<Key, Tuple, Compare>
+>::type;
+
+/** Get the indices of the first occurrences of the distinct types in a std::tuple.
+ *
+ * The element types are compared in a single constant evaluation, so the instantiation count is
+ * linear and the depth is constant.
+ *
+ * @code{.unparsed}
+ * tuple_unique_seq_t<t> = std::index_sequence<i_0, i_1, ..., i_(K-1)>
+ *
+ *      where t is the input tuple type
+ *        and i_0 < i_1 < ... < i_(K-1) are the indices i with t_j != t_i for all j < i
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ *
+ * @tparam  Tuple   Input tuple type.
+ */
+template<class Tuple>
+using tuple_unique_seq_t = typename detail::tuple_unique_seq_impl<Tuple>::type;
+
+/** Get the result type of removing duplicate types from a std::tuple.
+ *
+ * The first occurrence of every type is kept, in order.
+ *
+ * @code{.unparsed}
+ * tuple_unique_t<t> = std::tuple<t_(i_0), t_(i_1), ..., t_(i_(K-1))>
+ *
+ *      where t is the input tuple type
+ *        and i is tuple_unique_seq_t<t>
+ * @endcode
+ *
+ * @warning Behavior is undefined when @p Tuple is not a std::tuple type.
+ *
+ * @tparam  Tuple   Input tuple type.
+ */
+template<class Tuple>
+using tuple_unique_t = typename detail::tuple_select_impl<Tuple, tuple_unique_seq_t<Tuple>>::type;
+
+/** Get the set union of two std::tuple types.
+ *
+ * The result contains every distinct type of @p Lhs followed by every distinct type of @p Rhs that
+ * is not in @p Lhs, each in order of first occurrence.
+ *
+ * @code{.unparsed}
+ * tuple_union_t<a, b> = tuple_unique_t<tuple_cat_t<a, b>>
+ * @endcode
+ *
+ * @tparam  Lhs     Left input tuple type.
+ * @tparam  Rhs     Right input tuple type.
+ */
+template<class Lhs, class Rhs>
+using tuple_union_t = tuple_unique_t<tuple_cat_t<Lhs, Rhs>>;
+
+/** Get the set intersection of two std::tuple types.
+ *
+ * The result contains every distinct type of @p Lhs that is also in @p Rhs, in order of first
+ * occurrence in @p Lhs.
+ *
+ * @code{.unparsed}
+ * tuple_intersection_t<a, b> = tuple_filter_t<P_b, tuple_unique_t<a>>
+ *                 P_b<x>::value = tuple_contains_v<x, b>
+ * @endcode
+ *
+ * @tparam  Lhs     Left input tuple type.
+ * @tparam  Rhs     Right input tuple type.
+ */
+template<class Lhs, class Rhs>
+using tuple_intersection_t = typename detail::tuple_set_filter_impl<
+    tuple_unique_t<Lhs>,
+    Rhs,
+    true
+>::type;
+
+/** Get the set difference of two std::tuple types.
+ *
+ * The result contains every distinct type of @p Lhs that is not in @p Rhs, in order of first
+ * occurrence in @p Lhs.
+ *
+ * @code{.unparsed}
+ * tuple_difference_t<a, b> = tuple_filter_t<P_b, tuple_unique_t<a>>
+ *               P_b<x>::value = !tuple_contains_v<x, b>
+ * @endcode
+ *
+ * @tparam  Lhs     Left input tuple type.
+ * @tparam  Rhs     Right input tuple type.
+ */
+template<class Lhs, class Rhs>
+using tuple_difference_t = typename detail::tuple_set_filter_impl<
+    tuple_unique_t<Lhs>,
+    Rhs,
+    false
 >::type;
 
 } } // namespace fxx::meta
@@ -700,10 +1299,25 @@ static_assert(
     "fxx::meta::first: Trivial case"
 );
 static_assert(
-    first<std::is_signed, std::tuple<ushort, int, long>>::value
-    && first<std::is_signed, std::tuple<ushort, int, long>>::index == 1,
+    first<std::is_signed, std::tuple<unsigned short, int, long>>::value
+    && first<std::is_signed, std::tuple<unsigned short, int, long>>::index == 1,
     "fxx::meta::first: Recursive case"
 );
+static_assert(
+    first<
+        detail::short_circuit,
+        std::tuple<unsigned, short, detail::short_circuit_poison>
+    >::index == 1
+    && first<
+        detail::short_circuit,
+        std::tuple<
+            unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned,
+            unsigned, short, detail::short_circuit_poison, unsigned, unsigned, unsigned, unsigned,
+            unsigned
+        >
+    >::index == 9,
+    "fxx::meta::first: Short-circuit case"
+);
 
 // find
 static_assert(
@@ -720,6 +1334,37 @@ static_assert(
     && find<int, std::tuple<short, int, long>>::index == 1,
     "fxx::meta::find: Recursive case"
 );
+static_assert(
+    find<short, std::tuple<
+        unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned,
+        unsigned, short, detail::short_circuit_poison, unsigned, unsigned, unsigned, unsigned,
+        unsigned
+    >>::index == 9,
+    "fxx::meta::find: Short-circuit case"
+);
+
+// type_at_t
+static_assert(
+    std::is_same_v<int, type_at_t<0, std::tuple<int>>>,
+    "fxx::meta::type_at_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<int&&, type_at_t<2, std::tuple<int, int&, int&&>>>,
+    "fxx::meta::type_at_t: Regular case"
+);
+
+// types_at_t
+static_assert(
+    std::is_same_v<std::tuple<>, types_at_t<std::tuple<int, int&, int&&>>>,
+    "fxx::meta::types_at_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<int&, int, int&, int&&>,
+        types_at_t<std::tuple<int, int&, int&&>, 1, 0, 1, 2>
+    >,
+    "fxx::meta::types_at_t: Regular case"
+);
 
 // tuple_cat_t
 static_assert(
@@ -733,6 +1378,17 @@ static_assert(
     >,
     "fxx::meta::tuple_cat_t: Regular case"
 );
+static_assert(
+    std::is_same_v<
+        std::tuple<int, int&, int&&, int, int&, int&&, int, int&, int&&, int, int&, int&&>,
+        tuple_cat_t<
+            std::tuple<int>, std::tuple<int&, int&&>, std::tuple<>, std::tuple<int, int&>,
+            std::tuple<int&&, int>, std::tuple<int&>, std::tuple<>, std::tuple<int&&>,
+            std::tuple<int, int&, int&&>
+        >
+    >,
+    "fxx::meta::tuple_cat_t: Variadic case"
+);
 
 // tuple_flip_t
 static_assert(
@@ -866,6 +1522,26 @@ static_assert(
     "fxx::meta::tuple_reduce_t: Regular case"
 );
 
+// tuple_reduce_tree_t
+static_assert(
+    std::is_same_v<int, tuple_reduce_tree_t<std::tuple, std::tuple<int>>>,
+    "fxx::meta::tuple_reduce_tree_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<int,std::tuple<int&,int&&>>,
+        tuple_reduce_tree_t<std::tuple, std::tuple<int,int&,int&&>>
+    >,
+    "fxx::meta::tuple_reduce_tree_t: Regular case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<std::tuple<int,int&>,std::tuple<int&&,short>>,
+        tuple_reduce_tree_t<std::tuple, std::tuple<int,int&,int&&,short>>
+    >,
+    "fxx::meta::tuple_reduce_tree_t: Balanced case"
+);
+
 // tuple_fold_t
 static_assert(
     std::is_same_v<int, tuple_fold_t<std::tuple, int, std::tuple<>>>,
@@ -879,6 +1555,19 @@ static_assert(
     "fxx::meta::tuple_fold_t: Regular case"
 );
 
+// tuple_fold_tree_t
+static_assert(
+    std::is_same_v<int, tuple_fold_tree_t<std::tuple, int, std::tuple<>>>,
+    "fxx::meta::tuple_fold_tree_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<int,std::tuple<int&,std::tuple<int&&,short>>>,
+        tuple_fold_tree_t<std::tuple, int, std::tuple<int&,int&&,short>>
+    >,
+    "fxx::meta::tuple_fold_tree_t: Regular case"
+);
+
 // tuple_filter_t
 static_assert(
     std::is_same_v<std::tuple<>, tuple_filter_t<std::is_reference, std::tuple<>>>,
@@ -892,6 +1581,121 @@ static_assert(
     "fxx::meta::tuple_filter_t: Regular case"
 );
 
+// tuple_filter_seq_t
+static_assert(
+    std::is_same_v<std::index_sequence<>, tuple_filter_seq_t<std::is_reference, std::tuple<>>>,
+    "fxx::meta::tuple_filter_seq_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::index_sequence<1, 3>,
+        tuple_filter_seq_t<std::is_reference, std::tuple<int,int&,int,int&&>>
+    >,
+    "fxx::meta::tuple_filter_seq_t: Regular case"
+);
+
+// tuple_sort_indices_t
+static_assert(
+    std::is_same_v<std::index_sequence<>, tuple_sort_indices_t<std::alignment_of, std::tuple<>>>,
+    "fxx::meta::tuple_sort_indices_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::index_sequence<1, 3, 0, 2>,
+        tuple_sort_indices_t<std::alignment_of, std::tuple<int,char,int,char>>
+    >,
+    "fxx::meta::tuple_sort_indices_t: Stable case"
+);
+static_assert(
+    std::is_same_v<
+        std::index_sequence<0, 2, 1, 3>,
+        tuple_sort_indices_t<std::alignment_of, std::tuple<int,char,int,char>, std::greater<>>
+    >,
+    "fxx::meta::tuple_sort_indices_t: Descending case"
+);
+
+// tuple_sort_t
+static_assert(
+    std::is_same_v<std::tuple<>, tuple_sort_t<std::alignment_of, std::tuple<>>>,
+    "fxx::meta::tuple_sort_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<char,short,int&,int>,
+        tuple_sort_t<std::alignment_of, std::tuple<int&,short,char,int>>
+    >,
+    "fxx::meta::tuple_sort_t: Regular case"
+);
+
+// tuple_contains
+static_assert(
+    !tuple_contains_v<int, std::tuple<>>,
+    "fxx::meta::tuple_contains: Empty case"
+);
+static_assert(
+    tuple_contains_v<int, std::tuple<short, int, int>> && !tuple_contains_v<int&, std::tuple<int>>,
+    "fxx::meta::tuple_contains: Regular case"
+);
+
+// tuple_index_of
+static_assert(
+    tuple_index_of_v<int, std::tuple<>> == 0,
+    "fxx::meta::tuple_index_of: Empty case"
+);
+static_assert(
+    tuple_index_of_v<int, std::tuple<short, int, long, int>> == 1
+    && tuple_index_of_v<char, std::tuple<short, int, long, int>> == 4,
+    "fxx::meta::tuple_index_of: Regular case"
+);
+
+// tuple_unique_t
+static_assert(
+    std::is_same_v<std::tuple<>, tuple_unique_t<std::tuple<>>>,
+    "fxx::meta::tuple_unique_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<int,short,int&,long>,
+        tuple_unique_t<std::tuple<int,short,int,int&,short,long,int&>>
+    >,
+    "fxx::meta::tuple_unique_t: Regular case"
+);
+
+// tuple_union_t
+static_assert(
+    std::is_same_v<
+        std::tuple<int,short,long,char>,
+        tuple_union_t<std::tuple<int,short,int>, std::tuple<long,int,char>>
+    >,
+    "fxx::meta::tuple_union_t: Regular case"
+);
+
+// tuple_intersection_t
+static_assert(
+    std::is_same_v<std::tuple<>, tuple_intersection_t<std::tuple<int>, std::tuple<>>>,
+    "fxx::meta::tuple_intersection_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<int,long>,
+        tuple_intersection_t<std::tuple<int,short,int,long>, std::tuple<long,char,int>>
+    >,
+    "fxx::meta::tuple_intersection_t: Regular case"
+);
+
+// tuple_difference_t
+static_assert(
+    std::is_same_v<std::tuple<int>, tuple_difference_t<std::tuple<int,int>, std::tuple<>>>,
+    "fxx::meta::tuple_difference_t: Trivial case"
+);
+static_assert(
+    std::is_same_v<
+        std::tuple<short>,
+        tuple_difference_t<std::tuple<int,short,int,long>, std::tuple<long,char,int>>
+    >,
+    "fxx::meta::tuple_difference_t: Regular case"
+);
+
 } } // namespace fxx::meta
 
 #endif
\ No newline at end of file
@@ -0,0 +1,199 @@
+/** Implements a tuple that reorders its elements to minimize padding.
+ *
+ * `std::tuple<char, double, char, int, char>` stores its elements in declaration order, and pays
+ * for the alignment of every element with padding. fxx::packed_tuple instead stores its elements
+ * sorted by descending alignment and size, while exposing them in their logical order through a
+ * compile-time permutation.
+ *
+ * @file        packed_tuple.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_PACKED_TUPLE_H
+#define FXX_PACKED_TUPLE_H
+#pragma once
+
+#include <fxx/meta/tuple.h>
+// fxx::meta::(tuple_pick_t, tuple_sort_indices_t, type_at_t)
+
+#include <functional>
+// std::greater
+#include <tuple>
+// std::(forward_as_tuple, get, tuple, tuple_element, tuple_size)
+#include <type_traits>
+// std::(conjunction, decay_t, enable_if_t, integral_constant, is_constructible, is_same, negation)
+#include <utility>
+// std::(forward, index_sequence, move, pair)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx {
+
+namespace detail {
+
+// Packing key of an element: larger alignments first, then larger sizes.
+template<class T>
+struct packed_key {
+    static constexpr std::pair<std::size_t, std::size_t> value{alignof(T), sizeof(T)};
+};
+
+// Inverse of a storage permutation.
+template<std::size_t N>
+struct packed_position {
+    std::size_t index[N + 1];
+};
+
+template<std::size_t... Ks>
+constexpr auto make_packed_position() {
+    constexpr std::size_t order[] = {Ks..., 0};
+    packed_position<sizeof...(Ks)> position{};
+
+    for (std::size_t k = 0; k < sizeof...(Ks); ++k) {
+        position.index[order[k]] = k;
+    }
+
+    return position;
+}
+
+// Dispatch case.
+template<class, class>
+struct packed_storage {};
+
+// Flat case.
+template<class... Ts, std::size_t... Ks>
+struct packed_storage<std::tuple<Ts...>, std::index_sequence<Ks...>> {
+    using order = std::index_sequence<Ks...>;
+
+    static constexpr auto position = make_packed_position<Ks...>();
+    using type = meta::tuple_pick_t<std::tuple<Ts...>, Ks...>;
+};
+
+// Storage of a packed tuple, sorted stably by descending packing key.
+template<class... Ts>
+using packed_storage_t = packed_storage<
+    std::tuple<Ts...>,
+    meta::tuple_sort_indices_t<packed_key, std::tuple<Ts...>, std::greater<>>
+>;
+
+} // namespace detail
+
+/** Tuple that stores its elements in an order that minimizes padding.
+ *
+ * Elements are stored sorted by descending alignment and size (ties keep their logical order).
+ * They are accessed in their logical order through fxx::get, `std::tuple_size` and
+ * `std::tuple_element`, which also enables structured bindings and all fxx::tuple functors.
+ *
+ * @tparam  Ts  Element types in logical order.
+ */
+template<class... Ts>
+class packed_tuple {
+    using storage_impl = detail::packed_storage_t<Ts...>;
+
+public:
+    /** Underlying std::tuple type in storage order. */
+    using storage_type = typename storage_impl::type;
+
+    /** Storage position of logical element @p I. */
+    template<std::size_t I>
+    static constexpr std::size_t position = storage_impl::position.index[I];
+
+    constexpr packed_tuple() = default;
+
+    /** Construct from one argument per element, in logical order. */
+    template<
+        class... Us,
+        class = std::enable_if_t<
+            sizeof...(Us) == sizeof...(Ts)
+            && sizeof...(Us) != 0
+            && std::conjunction<
+                std::negation<std::is_same<std::decay_t<Us>, packed_tuple>>...,
+                std::is_constructible<Ts, Us&&>...
+            >::value
+        >
+    >
+    constexpr packed_tuple(Us&&... args)
+    : packed_tuple(
+        std::forward_as_tuple(std::forward<Us>(args)...),
+        typename storage_impl::order{}
+    ) {}
+
+    /** Get the underlying storage. */
+    constexpr storage_type& storage() & noexcept { return m_storage; }
+    /** Get the underlying storage. */
+    constexpr const storage_type& storage() const& noexcept { return m_storage; }
+    /** Get the underlying storage. */
+    constexpr storage_type&& storage() && noexcept { return std::move(m_storage); }
+    /** Get the underlying storage. */
+    constexpr const storage_type&& storage() const&& noexcept { return std::move(m_storage); }
+
+    friend constexpr bool operator==(const packed_tuple& lhs, const packed_tuple& rhs) {
+        return lhs.m_storage == rhs.m_storage;
+    }
+    friend constexpr bool operator!=(const packed_tuple& lhs, const packed_tuple& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    template<class Args, std::size_t... Ks>
+    constexpr packed_tuple(Args&& args, std::index_sequence<Ks...>)
+    : m_storage(std::get<Ks>(std::move(args))...) {}
+
+    storage_type m_storage;
+};
+
+template<class... Ts>
+packed_tuple(Ts...) -> packed_tuple<Ts...>;
+
+/** Get a packed_tuple element by logical index.
+ *
+ * @tparam  I   Logical element index.
+ *
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Reference to the element.
+ */
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(packed_tuple<Ts...>& tuple) noexcept {
+    return std::get<packed_tuple<Ts...>::template position<I>>(tuple.storage());
+}
+
+/** @copydoc get(packed_tuple<Ts...>&) */
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(const packed_tuple<Ts...>& tuple) noexcept {
+    return std::get<packed_tuple<Ts...>::template position<I>>(tuple.storage());
+}
+
+/** @copydoc get(packed_tuple<Ts...>&) */
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(packed_tuple<Ts...>&& tuple) noexcept {
+    return std::get<packed_tuple<Ts...>::template position<I>>(std::move(tuple).storage());
+}
+
+/** @copydoc get(packed_tuple<Ts...>&) */
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(const packed_tuple<Ts...>&& tuple) noexcept {
+    return std::get<packed_tuple<Ts...>::template position<I>>(std::move(tuple).storage());
+}
+
+} // namespace fxx
+
+namespace std {
+
+template<class... Ts>
+struct tuple_size<fxx::packed_tuple<Ts...>>
+: std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template<std::size_t I, class... Ts>
+struct tuple_element<I, fxx::packed_tuple<Ts...>> {
+    using type = fxx::meta::type_at_t<I, std::tuple<Ts...>>;
+};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,231 @@
+/** Implements a structure-of-arrays container for std::tuple records.
+ *
+ * A `std::vector<std::tuple<Ts...>>` interleaves all elements of a record, so that scans over a
+ * few columns waste most of each cache line. fxx::soa_vector instead keeps one contiguous column
+ * per element type, and exposes rows as tuples of references and columns as non-owning views.
+ *
+ * @file        soa_vector.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_SOA_VECTOR_H
+#define FXX_SOA_VECTOR_H
+#pragma once
+
+#include <fxx/meta/tuple.h>
+// fxx::meta::(apply_t, tuple_map_t, type_at_t)
+
+#include <algorithm>
+// std::min
+#include <tuple>
+// std::(get, tuple, tuple_size_v)
+#include <type_traits>
+// std::(add_lvalue_reference_t, bool_constant, is_object_v, is_same_v, remove_cv_t)
+#include <utility>
+// std::(forward, forward_as_tuple, index_sequence, make_index_sequence, move)
+#include <vector>
+// std::vector
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx {
+
+/** Non-owning view of a contiguous column.
+ *
+ * @tparam  T   Element type.
+ */
+template<class T>
+class column_view {
+public:
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using reference = T&;
+    using pointer = T*;
+    using iterator = T*;
+
+    constexpr column_view() noexcept = default;
+    constexpr column_view(T* data, std::size_t size) noexcept : m_data{data}, m_size{size} {}
+
+    constexpr T* data() const noexcept { return m_data; }
+    constexpr std::size_t size() const noexcept { return m_size; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    constexpr T* begin() const noexcept { return m_data; }
+    constexpr T* end() const noexcept { return m_data + m_size; }
+
+    constexpr T& operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+private:
+    T* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+namespace detail {
+
+template<class T>
+using soa_column_t = std::vector<T>;
+
+template<class T>
+using soa_const_ref_t = const T&;
+
+template<class T>
+using soa_const_view_t = column_view<const T>;
+
+// Indicates whether all element types can be stored in contiguous columns.
+template<class... Ts>
+struct soa_storable : std::bool_constant<(
+    (std::is_object_v<Ts> && !std::is_same_v<std::remove_cv_t<Ts>, bool>) && ...
+)> {};
+
+} // namespace detail
+
+/** Structure-of-arrays container of std::tuple records.
+ *
+ * Every element of @p Tuple is stored in its own std::vector, and all columns always have the same
+ * size. Rows are accessed through tuples of references, and columns through fxx::column_view. Since
+ * columns() returns a tuple of views, fxx::tuple::pick and fxx::tuple::slice select a subset of the
+ * columns without copying any elements.
+ *
+ * @warning Element types must be non-reference object types other than `bool`, because
+ *          `std::vector<bool>` is not contiguous.
+ *
+ * @tparam  Tuple   Record type (a std::tuple).
+ */
+template<class Tuple>
+class soa_vector {
+    static_assert(std::tuple_size_v<Tuple> > 0, "fxx::soa_vector: Records must not be empty.");
+    static_assert(
+        meta::apply_t<detail::soa_storable, Tuple>::value,
+        "fxx::soa_vector: Elements must be contiguously storable."
+    );
+
+    static constexpr std::size_t width = std::tuple_size_v<Tuple>;
+    using indices = std::make_index_sequence<width>;
+
+public:
+    using value_type = Tuple;
+    using size_type = std::size_t;
+    using storage_type = meta::tuple_map_t<detail::soa_column_t, Tuple>;
+    using reference = meta::tuple_map_t<std::add_lvalue_reference_t, Tuple>;
+    using const_reference = meta::tuple_map_t<detail::soa_const_ref_t, Tuple>;
+    using columns_type = meta::tuple_map_t<column_view, Tuple>;
+    using const_columns_type = meta::tuple_map_t<detail::soa_const_view_t, Tuple>;
+
+    /** Get the number of rows. */
+    std::size_t size() const noexcept { return std::get<0>(m_columns).size(); }
+    /** Determine whether there are no rows. */
+    bool empty() const noexcept { return size() == 0; }
+    /** Get the number of rows that fit into all columns without reallocating. */
+    std::size_t capacity() const noexcept { return capacity_impl(indices{}); }
+
+    /** Reserve capacity for @p n rows in all columns. */
+    void reserve(std::size_t n) { reserve_impl(n, indices{}); }
+    /** Remove all rows. */
+    void clear() noexcept { clear_impl(indices{}); }
+
+    /** Append a row by copying a record. */
+    void push_back(const Tuple& row) { emplace_row<0>(row); }
+    /** Append a row by moving a record. */
+    void push_back(Tuple&& row) { emplace_row<0>(std::move(row)); }
+
+    /** Append a row by constructing every column element from one argument.
+     *
+     * If constructing any element throws, the columns are restored to their previous size.
+     */
+    template<class... Us>
+    void emplace_back(Us&&... args) {
+        static_assert(sizeof...(Us) == width, "fxx::soa_vector: One argument per column.");
+        emplace_row<0>(std::forward_as_tuple(std::forward<Us>(args)...));
+    }
+
+    /** Remove the last row. */
+    void pop_back() noexcept { pop_back_impl(indices{}); }
+
+    /** Get a tuple of references to the elements of a row. */
+    reference operator[](std::size_t i) noexcept {
+        return row_impl<reference>(*this, i, indices{});
+    }
+    /** Get a tuple of const references to the elements of a row. */
+    const_reference operator[](std::size_t i) const noexcept {
+        return row_impl<const_reference>(*this, i, indices{});
+    }
+
+    /** Get a view of column @p I. */
+    template<std::size_t I>
+    column_view<meta::type_at_t<I, Tuple>> column() noexcept {
+        return {std::get<I>(m_columns).data(), size()};
+    }
+    /** Get a const view of column @p I. */
+    template<std::size_t I>
+    column_view<const meta::type_at_t<I, Tuple>> column() const noexcept {
+        return {std::get<I>(m_columns).data(), size()};
+    }
+
+    /** Get a tuple of views of all columns. */
+    columns_type columns() noexcept { return columns_impl<columns_type>(*this, indices{}); }
+    /** Get a tuple of const views of all columns. */
+    const_columns_type columns() const noexcept {
+        return columns_impl<const_columns_type>(*this, indices{});
+    }
+
+    /** Get the underlying column storage. */
+    const storage_type& storage() const noexcept { return m_columns; }
+
+private:
+    template<std::size_t... Ns>
+    std::size_t capacity_impl(std::index_sequence<Ns...>) const noexcept {
+        return std::min({std::get<Ns>(m_columns).capacity()...});
+    }
+
+    template<std::size_t... Ns>
+    void reserve_impl(std::size_t n, std::index_sequence<Ns...>) {
+        (std::get<Ns>(m_columns).reserve(n), ...);
+    }
+
+    template<std::size_t... Ns>
+    void clear_impl(std::index_sequence<Ns...>) noexcept {
+        (std::get<Ns>(m_columns).clear(), ...);
+    }
+
+    template<std::size_t... Ns>
+    void pop_back_impl(std::index_sequence<Ns...>) noexcept {
+        (std::get<Ns>(m_columns).pop_back(), ...);
+    }
+
+    // Append the elements of a row from column I onwards, rolling back on failure.
+    template<std::size_t I, class Row>
+    void emplace_row(Row&& row) {
+        if constexpr (I < width) {
+            auto& column = std::get<I>(m_columns);
+            column.emplace_back(std::get<I>(std::forward<Row>(row)));
+            try {
+                emplace_row<I + 1>(std::forward<Row>(row));
+            } catch (...) {
+                column.pop_back();
+                throw;
+            }
+        }
+    }
+
+    template<class Result, class Self, std::size_t... Ns>
+    static Result row_impl(Self& self, std::size_t i, std::index_sequence<Ns...>) noexcept {
+        return Result(std::get<Ns>(self.m_columns)[i]...);
+    }
+
+    template<class Result, class Self, std::size_t... Ns>
+    static Result columns_impl(Self& self, std::index_sequence<Ns...>) noexcept {
+        return Result(self.template column<Ns>()...);
+    }
+
+    storage_type m_columns;
+};
+
+} // namespace fxx
+
+#endif
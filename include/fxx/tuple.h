@@ -14,17 +14,37 @@
 #define FXX_TUPLE_H
 #pragma once
 
+#include <fxx/tuple/alloc.h>
+#include <fxx/tuple/compare.h>
 #include <fxx/tuple/dup.h>
+#include <fxx/tuple/extern.h>
+#include <fxx/tuple/filter.h>
 #include <fxx/tuple/find.h>
+#include <fxx/tuple/find_branchless.h>
 #include <fxx/tuple/first.h>
+#include <fxx/tuple/first_branchless.h>
 #include <fxx/tuple/flip.h>
 #include <fxx/tuple/fold.h>
+#include <fxx/tuple/fold_tree.h>
+#include <fxx/tuple/fold_until.h>
+#include <fxx/tuple/for_each.h>
+#include <fxx/tuple/hash.h>
 #include <fxx/tuple/map.h>
+#include <fxx/tuple/map_inplace.h>
+#include <fxx/tuple/par_map.h>
 #include <fxx/tuple/pick.h>
+#include <fxx/tuple/pipe.h>
 #include <fxx/tuple/reduce.h>
+#include <fxx/tuple/reduce_tree.h>
+#include <fxx/tuple/serialize.h>
 #include <fxx/tuple/skip.h>
 #include <fxx/tuple/slice.h>
 #include <fxx/tuple/take.h>
+#include <fxx/tuple/transpose.h>
+#include <fxx/tuple/views.h>
+#include <fxx/tuple/visit.h>
+#include <fxx/tuple/when_all.h>
+#include <fxx/tuple/zip.h>
 
 namespace fxx {
 
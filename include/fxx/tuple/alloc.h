@@ -0,0 +1,308 @@
+/** Implements allocator-aware std::tuple materialization.
+ *
+ * The functors in this file produce the same tuples as map_f, dup_f, pick_f and filter_f, but
+ * construct them through the allocator-extended constructor of std::tuple. Every element that
+ * uses the allocator (`std::uses_allocator`) is constructed with it, e.g. the std::pmr::string and
+ * std::pmr::vector elements of a result. Other elements are constructed as usual.
+ *
+ * Paired with a std::pmr::monotonic_buffer_resource, all intermediate results of a task are then
+ * released at once when the arena is destroyed:
+ *
+ * @code{.cpp}
+ * std::pmr::monotonic_buffer_resource arena;
+ * const auto names = fxx::tuple::pick_alloc<2, 0>(&arena, record);
+ * @endcode
+ *
+ * @file        tuple/alloc.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_ALLOC_H
+#define FXX_TUPLE_ALLOC_H
+#pragma once
+
+#include <fxx/meta/tuple.h>
+// fxx::meta::(tuple_dup_t, tuple_filter_seq_t)
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <memory>
+// std::(allocator_arg, allocator_arg_t)
+#include <memory_resource>
+// std::pmr::(memory_resource, polymorphic_allocator)
+#include <tuple>
+// std::(get, tuple, tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::(decay_t, is_constructible_v, is_convertible_v, is_invocable_v, is_lvalue_reference_v,
+//       uses_allocator_v)
+#include <utility>
+// std::(forward, index_sequence, make_index_sequence, move)
+
+#include <cstddef>
+// std::(byte, size_t)
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Get the allocator for an allocator or a memory resource.
+template<class Alloc>
+static decltype(auto) as_allocator(const Alloc& alloc) noexcept {
+    if constexpr (std::is_convertible_v<Alloc, std::pmr::memory_resource*>) {
+        return std::pmr::polymorphic_allocator<std::byte>(alloc);
+    } else {
+        return alloc;
+    }
+}
+
+// Invoke a mapping function, passing the allocator if it follows the leading-allocator convention.
+template<class Alloc, class Fn, class T>
+static decltype(auto) map_alloc_invoke(const Alloc& alloc, Fn& fn, T&& x) {
+    if constexpr (std::is_invocable_v<Fn&, std::allocator_arg_t, const Alloc&, T>) {
+        return fn(std::allocator_arg, alloc, std::forward<T>(x));
+    } else {
+        return fn(std::forward<T>(x));
+    }
+}
+
+template<class Alloc, class Fn, class Tuple, std::size_t... Ns>
+static auto map_alloc_impl(
+    const Alloc& alloc,
+    Fn&& fn,
+    Tuple&& tuple,
+    std::index_sequence<Ns...>
+) {
+    return std::tuple<
+        std::decay_t<decltype(
+            map_alloc_invoke(alloc, fn, detail::element<Ns>(std::forward<Tuple>(tuple)))
+        )>...
+    >(
+        std::allocator_arg,
+        alloc,
+        map_alloc_invoke(alloc, fn, detail::element<Ns>(std::forward<Tuple>(tuple)))...
+    );
+}
+
+// Construct an object by uses-allocator construction (without the std::pair special case).
+template<class T, class Alloc, class... Args>
+static T make_using_allocator(const Alloc& alloc, Args&&... args) {
+    if constexpr (!std::uses_allocator_v<T, Alloc>) {
+        return T(std::forward<Args>(args)...);
+    } else if constexpr (std::is_constructible_v<T, std::allocator_arg_t, const Alloc&, Args...>) {
+        return T(std::allocator_arg, alloc, std::forward<Args>(args)...);
+    } else {
+        return T(std::forward<Args>(args)..., alloc);
+    }
+}
+
+template<std::size_t I, bool Last, class Alloc, class Tuple>
+static decltype(auto) dup_alloc_element(const Alloc& alloc, Tuple&& tuple) {
+    if constexpr (std::is_lvalue_reference_v<Tuple>) {
+        return std::get<I>(tuple);
+    } else if constexpr (Last) {
+        return std::get<I>(std::move(tuple));
+    } else {
+        // Copy ahead into the allocator, because the last duplicate moves from the input.
+        using element_t = std::tuple_element_t<I, std::decay_t<Tuple>>;
+        return make_using_allocator<element_t>(alloc, std::get<I>(tuple));
+    }
+}
+
+template<std::size_t N, std::size_t M, class Alloc, class Tuple, std::size_t... Ks>
+static auto dup_alloc_impl(const Alloc& alloc, Tuple&& tuple, std::index_sequence<Ks...>) {
+    return fxx::meta::tuple_dup_t<N, std::decay_t<Tuple>>(
+        std::allocator_arg,
+        alloc,
+        dup_alloc_element<Ks % M, Ks / M == N - 1>(alloc, std::forward<Tuple>(tuple))...
+    );
+}
+
+// Dispatch case.
+template<class Seq>
+struct pick_alloc_seq {};
+
+// Variadic case.
+template<std::size_t... Ns>
+struct pick_alloc_seq<std::index_sequence<Ns...>> {
+    template<class Alloc, class Tuple>
+    static auto pick(const Alloc& alloc, Tuple&& tuple) {
+        return std::tuple<std::tuple_element_t<Ns, std::decay_t<Tuple>>...>(
+            std::allocator_arg,
+            alloc,
+            detail::element<Ns>(std::forward<Tuple>(tuple))...
+        );
+    }
+};
+
+} // namespace detail
+
+/** Functor for mapping std::tuple elements into an allocator-aware result.
+ *
+ * Like map_f, but every result element that uses the allocator is constructed with it. Unlike
+ * map_f, the result elements are decayed, so that a function that returns a reference copies the
+ * referenced value directly into the allocator.
+ *
+ * A function that computes new values (e.g. a std::pmr::string) builds them with their default
+ * allocator, i.e. through the default memory resource, and they are then copied into the result.
+ * To avoid this, the function may accept the allocator in the leading-allocator convention: if
+ * `fn(std::allocator_arg, alloc, x)` is valid, it is invoked that way instead of `fn(x)`, and can
+ * construct its results with @p alloc directly. For memory resources, @p alloc is passed as a
+ * `std::pmr::polymorphic_allocator<std::byte>`.
+ */
+struct map_alloc_f {
+    template<class Tuple>
+    using seq_t = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+    template<class Alloc, class Fn, class Tuple>
+    auto operator()(const Alloc& alloc, Fn&& fn, Tuple&& tuple) const {
+        return detail::map_alloc_impl(
+            detail::as_allocator(alloc),
+            fn,
+            std::forward<Tuple>(tuple),
+            seq_t<Tuple>{}
+        );
+    }
+};
+
+/** Map std::tuple elements into an allocator-aware result.
+ *
+ * See map_alloc_f for more details.
+ *
+ * @tparam  Alloc   Allocator type, or a pointer to a std::pmr::memory_resource.
+ * @tparam  Fn      Mapping function type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    alloc   Allocator or memory resource for the result elements.
+ * @param   [in]    fn      Mapping function, optionally taking `(std::allocator_arg, alloc, x)`.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result tuple.
+ */
+template<class Alloc, class Fn, class Tuple>
+auto map_alloc(const Alloc& alloc, Fn&& fn, Tuple&& tuple) {
+    return map_alloc_f{}(alloc, std::forward<Fn>(fn), std::forward<Tuple>(tuple));
+}
+
+/** Functor for duplicating std::tuples into an allocator-aware result.
+ *
+ * Like dup_f, but every result element that uses the allocator is constructed with it.
+ *
+ * @note    When duplicating from an rvalue, the last duplicate is moved from the input. If the
+ *          input element uses a different allocator, the move degrades to a copy into @p alloc.
+ *
+ * @tparam  N   Number of duplications.
+ */
+template<std::size_t N>
+struct dup_alloc_f {
+    template<class Tuple>
+    static constexpr auto size = std::tuple_size_v<std::decay_t<Tuple>>;
+
+    template<class Alloc, class Tuple>
+    auto operator()(const Alloc& alloc, Tuple&& tuple) const {
+        return detail::dup_alloc_impl<N, size<Tuple>>(
+            detail::as_allocator(alloc),
+            std::forward<Tuple>(tuple),
+            std::make_index_sequence<N * size<Tuple>>{}
+        );
+    }
+};
+
+/** Duplicate-concatenate a std::tuple into an allocator-aware result.
+ *
+ * See dup_alloc_f for more details.
+ *
+ * @tparam  N       Number of duplications.
+ * @tparam  Alloc   Allocator type, or a pointer to a std::pmr::memory_resource.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    alloc   Allocator or memory resource for the result elements.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result tuple.
+ */
+template<std::size_t N, class Alloc, class Tuple>
+auto dup_alloc(const Alloc& alloc, Tuple&& tuple) {
+    return dup_alloc_f<N>{}(alloc, std::forward<Tuple>(tuple));
+}
+
+/** Functor for picking std::tuple elements into an allocator-aware result.
+ *
+ * Like pick_f, but every result element that uses the allocator is constructed with it.
+ *
+ * @tparam  Ns  Picking indices.
+ */
+template<std::size_t... Ns>
+struct pick_alloc_f {
+    template<class Alloc, class Tuple>
+    auto operator()(const Alloc& alloc, Tuple&& tuple) const {
+        return detail::pick_alloc_seq<std::index_sequence<Ns...>>::pick(
+            detail::as_allocator(alloc),
+            std::forward<Tuple>(tuple)
+        );
+    }
+};
+
+/** Pick std::tuple elements into an allocator-aware result.
+ *
+ * See pick_alloc_f for more details.
+ *
+ * @tparam  Ns      Picking indices.
+ * @tparam  Alloc   Allocator type, or a pointer to a std::pmr::memory_resource.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    alloc   Allocator or memory resource for the result elements.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result tuple.
+ */
+template<std::size_t... Ns, class Alloc, class Tuple>
+auto pick_alloc(const Alloc& alloc, Tuple&& tuple) {
+    return pick_alloc_f<Ns...>{}(alloc, std::forward<Tuple>(tuple));
+}
+
+/** Functor for filtering std::tuple elements by type into an allocator-aware result.
+ *
+ * Like filter_f, but every result element that uses the allocator is constructed with it.
+ *
+ * @tparam  Pred    Predicate template.
+ */
+template<template<class> class Pred>
+struct filter_alloc_f {
+    template<class Tuple>
+    using seq_t = fxx::meta::tuple_filter_seq_t<Pred, std::decay_t<Tuple>>;
+
+    template<class Alloc, class Tuple>
+    auto operator()(const Alloc& alloc, Tuple&& tuple) const {
+        return detail::pick_alloc_seq<seq_t<Tuple>>::pick(
+            detail::as_allocator(alloc),
+            std::forward<Tuple>(tuple)
+        );
+    }
+};
+
+/** Filter std::tuple elements by type into an allocator-aware result.
+ *
+ * See filter_alloc_f for more details.
+ *
+ * @tparam  Pred    Predicate template.
+ * @tparam  Alloc   Allocator type, or a pointer to a std::pmr::memory_resource.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    alloc   Allocator or memory resource for the result elements.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result tuple.
+ */
+template<template<class> class Pred, class Alloc, class Tuple>
+auto filter_alloc(const Alloc& alloc, Tuple&& tuple) {
+    return filter_alloc_f<Pred>{}(alloc, std::forward<Tuple>(tuple));
+}
+
+} } // namespace fxx::tuple
+
+#endif
@@ -0,0 +1,126 @@
+/** Implements packing of std::tuple elements into their object representations.
+ *
+ * Tuples whose elements all have unique object representations (e.g. integers, enums and unpadded
+ * trivial structs) are equal exactly when the bytes of their elements are equal. Packing these
+ * bytes without padding lets hashing and comparison process a tuple in one pass, instead of
+ * expanding to a branch per element.
+ *
+ * @file        tuple/bytewise.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_BYTEWISE_H
+#define FXX_TUPLE_BYTEWISE_H
+#pragma once
+
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <cstring>
+// std::memcpy
+#include <memory>
+// std::addressof
+#include <tuple>
+// std::(tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::(bool_constant, conjunction, decay_t, has_unique_object_representations,
+//       integral_constant, is_trivially_copyable_v, remove_cv_t, remove_reference_t)
+#include <utility>
+// std::(index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Element type without reference and cv-qualification.
+template<class T>
+using bytewise_element_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+// Dispatch case.
+template<class Tuple, class Seq = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+struct is_bytewise {};
+
+// Variadic case.
+template<class Tuple, std::size_t... Ns>
+struct is_bytewise<Tuple, std::index_sequence<Ns...>> : std::conjunction<
+    std::has_unique_object_representations<bytewise_element_t<std::tuple_element_t<Ns, Tuple>>>...
+> {};
+
+// Indicates whether all elements of a tuple have unique object representations.
+template<class Tuple>
+static constexpr bool is_bytewise_v = is_bytewise<std::decay_t<Tuple>>::value;
+
+// Dispatch case.
+template<class Tuple, class Seq = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+struct bytewise_size {};
+
+// Variadic case.
+template<class Tuple, std::size_t... Ns>
+struct bytewise_size<Tuple, std::index_sequence<Ns...>> : std::integral_constant<
+    std::size_t,
+    (std::size_t{0} + ... + sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>))
+> {};
+
+// Number of bytes in the packed object representations of all elements of a tuple.
+template<class Tuple>
+static constexpr std::size_t bytewise_size_v = bytewise_size<std::decay_t<Tuple>>::value;
+
+// Copy the object representations of all elements to a buffer, without padding.
+template<class Tuple, std::size_t... Ns>
+static inline void bytewise_pack(
+    const Tuple& tuple,
+    unsigned char* out,
+    std::index_sequence<Ns...>
+) noexcept {
+    static_assert(
+        (std::is_trivially_copyable_v<bytewise_element_t<std::tuple_element_t<Ns, Tuple>>> && ...),
+        "Only trivially copyable elements can be copied bytewise!"
+    );
+
+    std::size_t offset = 0;
+    ((
+        std::memcpy(
+            out + offset,
+            std::addressof(detail::element<Ns>(tuple)),
+            sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>)
+        ),
+        offset += sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>)
+    ), ...);
+}
+
+// Copy packed object representations from a buffer to all elements.
+template<class Tuple, std::size_t... Ns>
+static inline void bytewise_unpack(
+    const unsigned char* in,
+    Tuple& tuple,
+    std::index_sequence<Ns...>
+) noexcept {
+    static_assert(
+        (std::is_trivially_copyable_v<bytewise_element_t<std::tuple_element_t<Ns, Tuple>>> && ...),
+        "Only trivially copyable elements can be copied bytewise!"
+    );
+
+    std::size_t offset = 0;
+    ((
+        std::memcpy(
+            std::addressof(detail::element<Ns>(tuple)),
+            in + offset,
+            sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>)
+        ),
+        offset += sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>)
+    ), ...);
+}
+
+} // namespace detail
+
+} } // namespace fxx::tuple
+
+#endif
@@ -0,0 +1,314 @@
+/** Implements lexicographic std::tuple comparison.
+ *
+ * @file        tuple/compare.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_COMPARE_H
+#define FXX_TUPLE_COMPARE_H
+#pragma once
+
+#include <fxx/tuple/bytewise.h>
+// fxx::tuple::detail::(bytewise_element_t, bytewise_pack, bytewise_size_v, is_bytewise_v)
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <cstring>
+// std::memcmp
+#include <tuple>
+// std::(tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::(bool_constant, conditional_t, conjunction, decay_t, enable_if_t, false_type,
+//       is_integral_v, is_same, is_same_v, is_signed_v, make_unsigned_t)
+#include <utility>
+// std::(declval, index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+#include <cstdint>
+// std::uint64_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Dispatch case.
+template<class, class, class = void>
+struct is_same_elements : std::false_type {};
+
+// Variadic case.
+template<class Lhs, class Rhs>
+struct is_same_elements<Lhs, Rhs, std::enable_if_t<
+    std::tuple_size_v<Lhs> == std::tuple_size_v<Rhs>
+>> : is_same_elements<Lhs, Rhs, std::make_index_sequence<std::tuple_size_v<Lhs>>> {};
+
+// Flat case.
+template<class Lhs, class Rhs, std::size_t... Ns>
+struct is_same_elements<Lhs, Rhs, std::index_sequence<Ns...>> : std::conjunction<
+    std::is_same<
+        bytewise_element_t<std::tuple_element_t<Ns, Lhs>>,
+        bytewise_element_t<std::tuple_element_t<Ns, Rhs>>
+    >...
+> {};
+
+// Indicates whether two tuples have the same element types up to references and cv-qualification.
+template<class Lhs, class Rhs>
+static constexpr bool is_same_elements_v =
+    is_same_elements<std::decay_t<Lhs>, std::decay_t<Rhs>>::value;
+
+// Indicates whether equality can compare the packed object representations.
+template<class Lhs, class Rhs>
+static constexpr bool is_bytewise_equal_v = is_same_elements_v<Lhs, Rhs> && is_bytewise_v<Lhs>;
+
+// Dispatch case.
+template<class Tuple, class Seq = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+struct is_integral_elements {};
+
+// Variadic case.
+template<class Tuple, std::size_t... Ns>
+struct is_integral_elements<Tuple, std::index_sequence<Ns...>> : std::conjunction<
+    std::bool_constant<
+        std::is_integral_v<bytewise_element_t<std::tuple_element_t<Ns, Tuple>>>
+        && sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>) <= sizeof(std::uint64_t)
+    >...
+> {};
+
+// Indicates whether ordering can compare big-endian packed keys, which requires integral elements
+// of at most 64 bits.
+template<class Lhs, class Rhs>
+static constexpr bool is_bytewise_order_v =
+    is_same_elements_v<Lhs, Rhs> && is_integral_elements<std::decay_t<Lhs>>::value;
+
+// Number of 64-bit words in a packed key.
+template<class Tuple>
+static constexpr std::size_t bytewise_words_v = (bytewise_size_v<Tuple> + 7) / 8;
+
+// Order-preserving unsigned key of an integer: signed integers have their sign bit flipped.
+template<class T>
+static constexpr std::uint64_t order_key(T x) noexcept {
+    using unsigned_t = std::make_unsigned_t<std::conditional_t<std::is_same_v<T, bool>, char, T>>;
+
+    auto u = static_cast<unsigned_t>(x);
+    if constexpr (std::is_signed_v<T>) {
+        u ^= static_cast<unsigned_t>(unsigned_t{1} << (sizeof(T) * 8 - 1));
+    }
+    return u;
+}
+
+// Place a key of the given bit width at a bit offset, counted from the most significant bit.
+static constexpr void order_put(
+    std::uint64_t* words,
+    std::size_t offset,
+    std::uint64_t key,
+    std::size_t width
+) noexcept {
+    const std::size_t i = offset / 64, bit = offset % 64;
+    if (bit + width <= 64) {
+        words[i] |= key << (64 - bit - width);
+    } else {
+        const std::size_t spill = bit + width - 64;
+        words[i] |= key >> spill;
+        words[i + 1] |= key << (64 - spill);
+    }
+}
+
+// Pack all elements into a big-endian key of 64-bit words, which orders like the tuples.
+//
+// For empty tuples, the pack expansion vanishes and leaves the parameters unused.
+template<class Tuple, std::size_t... Ns>
+static constexpr void order_pack(
+    [[maybe_unused]] const Tuple& tuple,
+    [[maybe_unused]] std::uint64_t* out,
+    std::index_sequence<Ns...>
+) noexcept {
+    std::size_t offset = 0;
+    ((
+        order_put(
+            out,
+            offset,
+            order_key(detail::element<Ns>(tuple)),
+            sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>) * 8
+        ),
+        offset += sizeof(bytewise_element_t<std::tuple_element_t<Ns, Tuple>>) * 8
+    ), ...);
+}
+
+template<class Lhs, class Rhs>
+static inline bool bytewise_equal(const Lhs& lhs, const Rhs& rhs) noexcept {
+    constexpr std::size_t size = bytewise_size_v<Lhs>;
+    constexpr auto seq = std::make_index_sequence<std::tuple_size_v<Lhs>>{};
+
+    unsigned char l[size > 0 ? size : 1], r[size > 0 ? size : 1];
+    bytewise_pack(lhs, l, seq);
+    bytewise_pack(rhs, r, seq);
+
+    return std::memcmp(l, r, size) == 0;
+}
+
+template<class Lhs, class Rhs>
+static constexpr int bytewise_compare(const Lhs& lhs, const Rhs& rhs) noexcept {
+    constexpr std::size_t words = bytewise_words_v<Lhs>;
+    constexpr auto seq = std::make_index_sequence<std::tuple_size_v<Lhs>>{};
+
+    std::uint64_t l[words > 0 ? words : 1]{}, r[words > 0 ? words : 1]{};
+    order_pack(lhs, l, seq);
+    order_pack(rhs, r, seq);
+
+    for (std::size_t i = 0; i < words; ++i) {
+        if (l[i] != r[i]) {
+            return l[i] < r[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+template<class Lhs, class Rhs, std::size_t... Ns>
+static constexpr bool generic_equal(const Lhs& lhs, const Rhs& rhs, std::index_sequence<Ns...>)
+noexcept((
+    noexcept(static_cast<bool>(detail::element<Ns>(lhs) == detail::element<Ns>(rhs))) && ...
+)) {
+    return (static_cast<bool>(detail::element<Ns>(lhs) == detail::element<Ns>(rhs)) && ...);
+}
+
+template<class L, class R>
+static constexpr int three_way(const L& l, const R& r)
+noexcept(noexcept(static_cast<bool>(l < r)) && noexcept(static_cast<bool>(r < l))) {
+    return static_cast<bool>(l < r) ? -1 : static_cast<bool>(r < l) ? 1 : 0;
+}
+
+template<class Lhs, class Rhs, std::size_t... Ns>
+static constexpr int generic_compare(const Lhs& lhs, const Rhs& rhs, std::index_sequence<Ns...>)
+noexcept((noexcept(three_way(detail::element<Ns>(lhs), detail::element<Ns>(rhs))) && ...)) {
+    int result = 0;
+    (((result = three_way(detail::element<Ns>(lhs), detail::element<Ns>(rhs))) == 0) && ...);
+    return result;
+}
+
+template<class Tuple>
+using compare_seq = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+} // namespace detail
+
+/** Functor for comparing std::tuples for equality.
+ *
+ * When both tuples have the same element types, and all of them have unique object
+ * representations, the packed object representations are compared in one pass. Otherwise, the
+ * elements are compared in order until the first mismatch.
+ *
+ * @warning The bytewise path can not be evaluated in constant expressions.
+ */
+struct equal_f {
+    template<class Lhs, class Rhs>
+    constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    noexcept(noexcept(detail::generic_equal(lhs, rhs, detail::compare_seq<Lhs>{}))) {
+        static_assert(
+            std::tuple_size_v<std::decay_t<Lhs>> == std::tuple_size_v<std::decay_t<Rhs>>,
+            "Tuples of different sizes can not be compared!"
+        );
+
+        if constexpr (detail::is_bytewise_equal_v<Lhs, Rhs>) {
+            return detail::bytewise_equal(lhs, rhs);
+        } else {
+            return detail::generic_equal(lhs, rhs, detail::compare_seq<Lhs>{});
+        }
+    }
+};
+
+/** Functor for comparing std::tuples lexicographically.
+ *
+ * When both tuples have the same integral element types, they are packed into big-endian keys and
+ * compared one 64-bit word at a time. Otherwise, the elements are compared in order using
+ * `operator<` until the first difference.
+ *
+ * @return  A negative value, zero or a positive value if @p lhs is less than, equivalent to or
+ *          greater than @p rhs, respectively.
+ */
+struct compare_f {
+    template<class Lhs, class Rhs>
+    constexpr int operator()(const Lhs& lhs, const Rhs& rhs) const
+    noexcept(noexcept(detail::generic_compare(lhs, rhs, detail::compare_seq<Lhs>{}))) {
+        static_assert(
+            std::tuple_size_v<std::decay_t<Lhs>> == std::tuple_size_v<std::decay_t<Rhs>>,
+            "Tuples of different sizes can not be compared!"
+        );
+
+        if constexpr (detail::is_bytewise_order_v<Lhs, Rhs>) {
+            return detail::bytewise_compare(lhs, rhs);
+        } else {
+            return detail::generic_compare(lhs, rhs, detail::compare_seq<Lhs>{});
+        }
+    }
+};
+
+/** Functor for ordering std::tuples lexicographically.
+ *
+ * Equivalent to `compare_f{}(lhs, rhs) < 0`, and usable as a comparator for std::sort and the
+ * ordered containers.
+ */
+struct less_f {
+    template<class Lhs, class Rhs>
+    constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    noexcept(noexcept(compare_f{}(lhs, rhs))) {
+        return compare_f{}(lhs, rhs) < 0;
+    }
+};
+
+/** Compare std::tuples for equality.
+ *
+ * See equal_f for more details.
+ *
+ * @tparam  Lhs     Left tuple type.
+ * @tparam  Rhs     Right tuple type.
+ *
+ * @param   [in]    lhs     Left tuple.
+ * @param   [in]    rhs     Right tuple.
+ *
+ * @return  bool
+ */
+template<class Lhs, class Rhs>
+constexpr bool equal(const Lhs& lhs, const Rhs& rhs) noexcept(noexcept(equal_f{}(lhs, rhs))) {
+    return equal_f{}(lhs, rhs);
+}
+
+/** Compare std::tuples lexicographically.
+ *
+ * See compare_f for more details.
+ *
+ * @tparam  Lhs     Left tuple type.
+ * @tparam  Rhs     Right tuple type.
+ *
+ * @param   [in]    lhs     Left tuple.
+ * @param   [in]    rhs     Right tuple.
+ *
+ * @return  int
+ */
+template<class Lhs, class Rhs>
+constexpr int compare(const Lhs& lhs, const Rhs& rhs) noexcept(noexcept(compare_f{}(lhs, rhs))) {
+    return compare_f{}(lhs, rhs);
+}
+
+/** Order std::tuples lexicographically.
+ *
+ * See less_f for more details.
+ *
+ * @tparam  Lhs     Left tuple type.
+ * @tparam  Rhs     Right tuple type.
+ *
+ * @param   [in]    lhs     Left tuple.
+ * @param   [in]    rhs     Right tuple.
+ *
+ * @return  bool
+ */
+template<class Lhs, class Rhs>
+constexpr bool less(const Lhs& lhs, const Rhs& rhs) noexcept(noexcept(less_f{}(lhs, rhs))) {
+    return less_f{}(lhs, rhs);
+}
+
+} } // namespace fxx::tuple
+
+#endif
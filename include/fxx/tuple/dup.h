@@ -13,46 +13,101 @@
 #define FXX_TUPLE_DUP_H
 #pragma once
 
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
 #include <tuple>
-// std::(tuple, tuple_cat)
+// std::(tuple, tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::(decay_t, is_lvalue_reference_v)
 #include <utility>
-// std::forward
+// std::(declval, forward, index_sequence, make_index_sequence, move)
 
 #include <cstddef>
 // std::size_t
 
 namespace fxx { namespace tuple {
 
-/** Functor for duplicating std::tuples.
+namespace detail {
+
+template<std::size_t I, bool Last, class Tuple>
+static constexpr decltype(auto) dup_element(Tuple&& tuple)
+noexcept(
+    std::is_lvalue_reference_v<Tuple>
+    || Last
+    || std::is_nothrow_convertible_v<
+        decltype(element<I>(tuple)),
+        std::tuple_element_t<I, std::decay_t<Tuple>>
+    >
+) {
+    if constexpr (std::is_lvalue_reference_v<Tuple>) {
+        return element<I>(tuple);
+    } else if constexpr (Last) {
+        return element<I>(std::move(tuple));
+    } else {
+        // Copy ahead of the result construction, because the last duplicate moves from the input.
+        using element_t = std::tuple_element_t<I, std::decay_t<Tuple>>;
+        return static_cast<element_t>(element<I>(tuple));
+    }
+}
+
+// Indicates whether duplicating elements can not throw.
+template<std::size_t N, std::size_t M, class Tuple, std::size_t... Ks>
+static constexpr bool is_nothrow_dup_v = (
+    (
+        noexcept(dup_element<Ks % M, Ks / M == N - 1>(std::declval<Tuple>()))
+        && std::is_nothrow_convertible_v<
+            decltype(dup_element<Ks % M, Ks / M == N - 1>(std::declval<Tuple>())),
+            std::tuple_element_t<Ks % M, std::decay_t<Tuple>>
+        >
+    ) && ...
+);
+
+template<std::size_t N, std::size_t M, class Tuple, std::size_t... Ks>
+static constexpr auto dup_impl(Tuple&& tuple, std::index_sequence<Ks...>)
+noexcept(is_nothrow_dup_v<N, M, Tuple, Ks...>) {
+    return std::tuple<std::tuple_element_t<Ks % M, std::decay_t<Tuple>>...>(
+        dup_element<Ks % M, Ks / M == N - 1>(std::forward<Tuple>(tuple))...
+    );
+}
+
+} // namespace detail
+
+/** Functor for duplicating tuples.
+ *
+ * The result tuple is constructed once, without intermediate tuples. If @p Tuple is an lvalue, all
+ * duplicates are copies. If @p Tuple is an rvalue, the first N-1 duplicates are copies and the last
+ * duplicate is moved from the input, so that no slot observes a moved-from value.
  *
  * @todo    Adapt documentation from fxx::meta::tuple_dup_t.
  *
+ * @note    Because the construction order of std::tuple elements is unspecified, the copies from
+ *          an rvalue are made before the result is constructed, and are then moved into place.
+ *
  * @tparam  N   Number of duplications.
  */
-// Recursive case.
 template<std::size_t N>
 struct dup_f {
     template<class Tuple>
-    constexpr auto operator()(Tuple&& tuple) noexcept {
-        return std::tuple_cat(
-            std::forward<Tuple>(tuple),
-            dup_f<N-1>{}(std::forward<Tuple>(tuple))
-        );
-    }
-};
+    static constexpr auto size = std::tuple_size_v<std::decay_t<Tuple>>;
 
-/// @cond
-// Abort case
-template<>
-struct dup_f<0> {
     template<class Tuple>
-    constexpr std::tuple<> operator()(Tuple&&) noexcept {
-        return {};
+    constexpr auto operator()(Tuple&& tuple) noexcept(noexcept(
+        detail::dup_impl<N, size<Tuple>>(
+            std::forward<Tuple>(tuple),
+            std::make_index_sequence<N * size<Tuple>>{}
+        )
+    )) {
+        return detail::dup_impl<N, size<Tuple>>(
+            std::forward<Tuple>(tuple),
+            std::make_index_sequence<N * size<Tuple>>{}
+        );
     }
 };
-/// @endcond
 
-/** Duplicate-concatenate a std::tuple.
+/** Duplicate-concatenate a tuple.
  *
  * @todo    Adapt documentation from fxx::meta::tuple_dup_t.
  *
@@ -64,7 +119,7 @@ struct dup_f<0> {
  * @return  Result tuple.
  */
 template<std::size_t N, class Tuple>
-constexpr auto dup(Tuple&& tuple) noexcept {
+constexpr auto dup(Tuple&& tuple) noexcept(noexcept(dup_f<N>{}(std::forward<Tuple>(tuple)))) {
     return dup_f<N>{}(std::forward<Tuple>(tuple));
 }
 
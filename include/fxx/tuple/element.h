@@ -0,0 +1,51 @@
+/** Implements element access for tuple-like types.
+ *
+ * The functors in fxx::tuple access elements through detail::element, which finds `get` by
+ * argument-dependent lookup in addition to std::get. This allows them to operate on tuple-like
+ * types such as fxx::packed_tuple, which cannot overload std::get.
+ *
+ * @file        tuple/element.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_ELEMENT_H
+#define FXX_TUPLE_ELEMENT_H
+#pragma once
+
+#include <tuple>
+// std::get
+#include <utility>
+// std::forward
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+namespace adl {
+
+using std::get;
+
+// Get a tuple element, using std::get or a get found by argument-dependent lookup.
+template<std::size_t I, class Tuple>
+constexpr auto element(Tuple&& tuple) noexcept(noexcept(get<I>(std::forward<Tuple>(tuple))))
+-> decltype(get<I>(std::forward<Tuple>(tuple))) {
+    return get<I>(std::forward<Tuple>(tuple));
+}
+
+} // namespace adl
+
+using adl::element;
+
+} // namespace detail
+
+} } // namespace fxx::tuple
+
+#endif
@@ -0,0 +1,180 @@
+/** Implements explicit instantiation of std::tuple functors for fixed tuple shapes.
+ *
+ * Every translation unit that invokes map_f, fold_f or pick_f with the same arguments instantiates
+ * and emits the same specializations, which the linker then deduplicates. The macros in this file
+ * declare such specializations `extern template` in every translation unit, and instantiate them
+ * once in a single library translation unit:
+ *
+ * @code{.cpp}
+ * // shapes.h, included wherever the shapes are used.
+ * using point_t = std::tuple<float, float, float>;
+ * FXX_EXTERN_TUPLE_FOLD(std::plus<>, float, point_t)
+ * FXX_EXTERN_TUPLE_PICK(point_t, 2, 1, 0)
+ *
+ * // shapes.cpp, compiled once.
+ * FXX_INSTANTIATE_TUPLE_FOLD(std::plus<>, float, point_t)
+ * FXX_INSTANTIATE_TUPLE_PICK(point_t, 2, 1, 0)
+ * @endcode
+ *
+ * Each macro covers the `const&`, `&` and `&&` value categories of the tuple. The function object
+ * and initial value types are used as deduced from the call, i.e. without reference for prvalue
+ * arguments. Type arguments that contain commas must be passed through type aliases.
+ *
+ * When the fxx target is built with `FXX_EXTERN_TEMPLATES`, it defines `FXX_TUPLE_EXTERN_CACHE`
+ * for its consumers, and instantiates the shapes in FXX_TUPLE_CACHE in `src/fxx.cpp`.
+ *
+ * @note    map_f and pick_f have deduced return types, so their bodies are still instantiated at
+ *          every call to determine the result type. Their extern declarations only avoid emitting
+ *          the out-of-line definitions. fold_f declares its result type, so its body is only
+ *          instantiated where the optimizer wants to inline it.
+ *
+ * @file        tuple/extern.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_EXTERN_H
+#define FXX_TUPLE_EXTERN_H
+#pragma once
+
+#include <fxx/tuple/fold.h>
+// fxx::tuple::fold_f
+#include <fxx/tuple/map.h>
+// fxx::tuple::map_f
+#include <fxx/tuple/pick.h>
+// fxx::tuple::pick_f
+
+#include <functional>
+// std::(multiplies, negate, plus)
+#include <tuple>
+// std::tuple
+#include <type_traits>
+// std::conditional_t
+#include <utility>
+// std::declval
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Tuple argument type for value category K (0 = const&, 1 = &, 2 = &&).
+template<int K, class Tuple>
+using extern_arg_t = std::conditional_t<
+    K == 0,
+    const Tuple&,
+    std::conditional_t<K == 1, Tuple&, Tuple&&>
+>;
+
+// Forwarding parameter type.
+template<class T>
+using extern_param_t = T&&;
+
+// Result type of a fold_f specialization.
+template<class Fn, class Init, class Tuple>
+using extern_fold_t = decltype(
+    std::declval<fold_f&>()(std::declval<Fn>(), std::declval<Init>(), std::declval<Tuple>())
+);
+
+// Tuple shapes cached by the fxx library.
+using cache_int2_t = std::tuple<int, int>;
+using cache_int3_t = std::tuple<int, int, int>;
+using cache_double2_t = std::tuple<double, double>;
+using cache_double3_t = std::tuple<double, double, double>;
+
+} // namespace detail
+
+} } // namespace fxx::tuple
+
+// Explicit instantiation of map_f for value category K.
+#define FXX_TUPLE_MAP_INSTANCE(Prefix, K, Fn, Tuple)                                              \
+    Prefix template auto ::fxx::tuple::map_f::operator()<                                         \
+        Fn,                                                                                       \
+        ::fxx::tuple::detail::extern_arg_t<K, Tuple>                                              \
+    >(                                                                                            \
+        ::fxx::tuple::detail::extern_param_t<Fn>,                                                 \
+        ::fxx::tuple::detail::extern_arg_t<K, Tuple>                                              \
+    );
+
+// Explicit instantiation of fold_f for value category K.
+#define FXX_TUPLE_FOLD_INSTANCE(Prefix, K, Fn, Init, Tuple)                                       \
+    Prefix template auto ::fxx::tuple::fold_f::operator()<                                        \
+        Fn,                                                                                       \
+        Init,                                                                                     \
+        ::fxx::tuple::detail::extern_arg_t<K, Tuple>                                              \
+    >(                                                                                            \
+        ::fxx::tuple::detail::extern_param_t<Fn>,                                                 \
+        ::fxx::tuple::detail::extern_param_t<Init>,                                               \
+        ::fxx::tuple::detail::extern_arg_t<K, Tuple>                                              \
+    ) -> ::fxx::tuple::detail::extern_fold_t<                                                     \
+        Fn,                                                                                       \
+        Init,                                                                                     \
+        ::fxx::tuple::detail::extern_arg_t<K, Tuple>                                              \
+    >;
+
+// Explicit instantiation of pick_f for value category K.
+#define FXX_TUPLE_PICK_INSTANCE(Prefix, K, Tuple, ...)                                            \
+    Prefix template auto ::fxx::tuple::pick_f<__VA_ARGS__>::operator()<                           \
+        ::fxx::tuple::detail::extern_arg_t<K, Tuple>                                              \
+    >(::fxx::tuple::detail::extern_arg_t<K, Tuple>);
+
+// Explicit instantiations of map_f for all value categories.
+#define FXX_TUPLE_MAP_INSTANCES(Prefix, Fn, Tuple)                                                \
+    FXX_TUPLE_MAP_INSTANCE(Prefix, 0, Fn, Tuple)                                                  \
+    FXX_TUPLE_MAP_INSTANCE(Prefix, 1, Fn, Tuple)                                                  \
+    FXX_TUPLE_MAP_INSTANCE(Prefix, 2, Fn, Tuple)
+
+// Explicit instantiations of fold_f for all value categories.
+#define FXX_TUPLE_FOLD_INSTANCES(Prefix, Fn, Init, Tuple)                                         \
+    FXX_TUPLE_FOLD_INSTANCE(Prefix, 0, Fn, Init, Tuple)                                           \
+    FXX_TUPLE_FOLD_INSTANCE(Prefix, 1, Fn, Init, Tuple)                                           \
+    FXX_TUPLE_FOLD_INSTANCE(Prefix, 2, Fn, Init, Tuple)
+
+// Explicit instantiations of pick_f for all value categories.
+#define FXX_TUPLE_PICK_INSTANCES(Prefix, Tuple, ...)                                              \
+    FXX_TUPLE_PICK_INSTANCE(Prefix, 0, Tuple, __VA_ARGS__)                                        \
+    FXX_TUPLE_PICK_INSTANCE(Prefix, 1, Tuple, __VA_ARGS__)                                        \
+    FXX_TUPLE_PICK_INSTANCE(Prefix, 2, Tuple, __VA_ARGS__)
+
+/** Declare the map_f specializations for a function object and tuple type `extern template`. */
+#define FXX_EXTERN_TUPLE_MAP(Fn, Tuple) FXX_TUPLE_MAP_INSTANCES(extern, Fn, Tuple)
+/** Instantiate the map_f specializations for a function object and tuple type. */
+#define FXX_INSTANTIATE_TUPLE_MAP(Fn, Tuple) FXX_TUPLE_MAP_INSTANCES(, Fn, Tuple)
+
+/** Declare the fold_f specializations for a function object, initial value and tuple type
+ * `extern template`.
+ */
+#define FXX_EXTERN_TUPLE_FOLD(Fn, Init, Tuple) FXX_TUPLE_FOLD_INSTANCES(extern, Fn, Init, Tuple)
+/** Instantiate the fold_f specializations for a function object, initial value and tuple type. */
+#define FXX_INSTANTIATE_TUPLE_FOLD(Fn, Init, Tuple) FXX_TUPLE_FOLD_INSTANCES(, Fn, Init, Tuple)
+
+/** Declare the pick_f specializations for a tuple type and picking indices `extern template`. */
+#define FXX_EXTERN_TUPLE_PICK(Tuple, ...) FXX_TUPLE_PICK_INSTANCES(extern, Tuple, __VA_ARGS__)
+/** Instantiate the pick_f specializations for a tuple type and picking indices. */
+#define FXX_INSTANTIATE_TUPLE_PICK(Tuple, ...) FXX_TUPLE_PICK_INSTANCES(, Tuple, __VA_ARGS__)
+
+/** Specializations cached by the fxx library, with Prefix either `extern` or empty. */
+#define FXX_TUPLE_CACHE(Prefix)                                                                   \
+    FXX_TUPLE_MAP_INSTANCES(Prefix, std::negate<>, ::fxx::tuple::detail::cache_int2_t)            \
+    FXX_TUPLE_MAP_INSTANCES(Prefix, std::negate<>, ::fxx::tuple::detail::cache_int3_t)            \
+    FXX_TUPLE_MAP_INSTANCES(Prefix, std::negate<>, ::fxx::tuple::detail::cache_double2_t)         \
+    FXX_TUPLE_MAP_INSTANCES(Prefix, std::negate<>, ::fxx::tuple::detail::cache_double3_t)         \
+    FXX_TUPLE_FOLD_INSTANCES(Prefix, std::plus<>, int, ::fxx::tuple::detail::cache_int2_t)        \
+    FXX_TUPLE_FOLD_INSTANCES(Prefix, std::plus<>, int, ::fxx::tuple::detail::cache_int3_t)        \
+    FXX_TUPLE_FOLD_INSTANCES(Prefix, std::plus<>, double, ::fxx::tuple::detail::cache_double2_t)  \
+    FXX_TUPLE_FOLD_INSTANCES(Prefix, std::plus<>, double, ::fxx::tuple::detail::cache_double3_t)  \
+    FXX_TUPLE_FOLD_INSTANCES(Prefix, std::multiplies<>, int, ::fxx::tuple::detail::cache_int2_t)  \
+    FXX_TUPLE_FOLD_INSTANCES(Prefix, std::multiplies<>, int, ::fxx::tuple::detail::cache_int3_t)  \
+    FXX_TUPLE_PICK_INSTANCES(Prefix, ::fxx::tuple::detail::cache_int2_t, 1, 0)                    \
+    FXX_TUPLE_PICK_INSTANCES(Prefix, ::fxx::tuple::detail::cache_int3_t, 2, 1, 0)                 \
+    FXX_TUPLE_PICK_INSTANCES(Prefix, ::fxx::tuple::detail::cache_double2_t, 1, 0)                 \
+    FXX_TUPLE_PICK_INSTANCES(Prefix, ::fxx::tuple::detail::cache_double3_t, 2, 1, 0)
+
+#ifdef FXX_TUPLE_EXTERN_CACHE
+FXX_TUPLE_CACHE(extern)
+#endif
+
+#endif
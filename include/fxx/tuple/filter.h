@@ -0,0 +1,73 @@
+/** Implements std::tuple filtering.
+ *
+ * @file        tuple/filter.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_FILTER_H
+#define FXX_TUPLE_FILTER_H
+#pragma once
+
+#include <fxx/meta/indices.h>
+// fxx::meta::apply_index_sequence_t
+#include <fxx/meta/tuple.h>
+// fxx::meta::tuple_filter_seq_t
+
+#include <fxx/tuple/pick.h>
+// fxx::tuple::pick_f
+
+#include <type_traits>
+// std::decay_t
+#include <utility>
+// std::forward
+
+namespace fxx { namespace tuple {
+
+/** Functor for filtering std::tuple elements by type.
+ *
+ * Only the kept elements are copied or moved into the result, which is constructed once.
+ *
+ * @todo    Adapt documentation from fxx::meta::tuple_filter_t.
+ *
+ * @tparam  Pred    Predicate template.
+ */
+template<template<class> class Pred>
+struct filter_f {
+    template<class Tuple>
+    using pick_f_t = fxx::meta::apply_index_sequence_t<
+        pick_f,
+        fxx::meta::tuple_filter_seq_t<Pred, std::decay_t<Tuple>>
+    >;
+
+    template<class Tuple>
+    constexpr auto operator()(Tuple&& tuple)
+    noexcept(noexcept(pick_f_t<Tuple>{}(std::forward<Tuple>(tuple)))) {
+        return pick_f_t<Tuple>{}(std::forward<Tuple>(tuple));
+    }
+};
+
+/** Filter std::tuple elements by type.
+ *
+ * @todo    Adapt documentation from fxx::meta::tuple_filter_t.
+ *
+ * @tparam  Pred    Predicate template.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result tuple.
+ */
+template<template<class> class Pred, class Tuple>
+constexpr auto filter(Tuple&& tuple)
+noexcept(noexcept(filter_f<Pred>{}(std::forward<Tuple>(tuple)))) {
+    return filter_f<Pred>{}(std::forward<Tuple>(tuple));
+}
+
+} } // namespace fxx::tuple
+
+#endif
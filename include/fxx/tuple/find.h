@@ -21,17 +21,30 @@
 
 namespace fxx { namespace tuple {
 
+namespace detail {
+
+// Predicate that compares elements to a value.
+template<class T>
+struct find_pred {
+    T& value;
+
+    template<class U>
+    constexpr bool operator()(U&& x) noexcept(noexcept(static_cast<bool>(value == x))) {
+        return value == x;
+    }
+};
+
+} // namespace detail
+
 /** Functor for finding std::tuple elements.
  *
  * @todo    Adapt documentation from fxx::meta::find.
  */
 struct find_f {
     template<class T, class Tuple>
-    constexpr auto operator()(T&& value, Tuple&& tuple) {
-        return first(
-            [&value](auto&& x) { return value == x; },
-            std::forward<Tuple>(tuple)
-        );
+    constexpr auto operator()(T&& value, Tuple&& tuple)
+    noexcept(noexcept(first(detail::find_pred<T>{value}, std::forward<Tuple>(tuple)))) {
+        return first(detail::find_pred<T>{value}, std::forward<Tuple>(tuple));
     }
 };
 
@@ -48,7 +61,8 @@ struct find_f {
  * @return  std::optional<std::size_t>
  */
 template<class T, class Tuple>
-constexpr auto find(T&& value, Tuple&& tuple) {
+constexpr auto find(T&& value, Tuple&& tuple)
+noexcept(noexcept(find_f{}(std::forward<T>(value), std::forward<Tuple>(tuple)))) {
     return find_f{}(std::forward<T>(value), std::forward<Tuple>(tuple));
 }
 
@@ -0,0 +1,61 @@
+/** Implements branchless std::tuple element finding.
+ *
+ * @file        tuple/find_branchless.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_FIND_BRANCHLESS_H
+#define FXX_TUPLE_FIND_BRANCHLESS_H
+#pragma once
+
+#include <fxx/tuple/find.h>
+// fxx::tuple::detail::find_pred
+#include <fxx/tuple/first_branchless.h>
+// fxx::tuple::first_branchless
+
+#include <utility>
+// std::forward
+
+namespace fxx { namespace tuple {
+
+/** Functor for finding std::tuple elements without branching on the comparison results.
+ *
+ * Compares the value to all elements unconditionally, see first_branchless_f for the trade-offs.
+ *
+ * @todo    Adapt documentation from fxx::meta::find.
+ */
+struct find_branchless_f {
+    template<class T, class Tuple>
+    constexpr auto operator()(T&& value, Tuple&& tuple) noexcept(noexcept(
+        first_branchless(detail::find_pred<T>{value}, std::forward<Tuple>(tuple))
+    )) {
+        return first_branchless(detail::find_pred<T>{value}, std::forward<Tuple>(tuple));
+    }
+};
+
+/** Find the first occurence of an element in a std::tuple, without branching on the comparisons.
+ *
+ * See find_branchless_f for more details.
+ *
+ * @tparam  T       Element type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    value   Value.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  std::optional<std::size_t>
+ */
+template<class T, class Tuple>
+constexpr auto find_branchless(T&& value, Tuple&& tuple)
+noexcept(noexcept(find_branchless_f{}(std::forward<T>(value), std::forward<Tuple>(tuple)))) {
+    return find_branchless_f{}(std::forward<T>(value), std::forward<Tuple>(tuple));
+}
+
+} } // namespace fxx::tuple
+
+#endif
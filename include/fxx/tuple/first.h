@@ -13,34 +13,55 @@
 #define FXX_TUPLE_FIRST_H
 #pragma once
 
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
 #include <optional>
 // std::(nullopt, nullopt_t, optional)
 #include <tuple>
-// std::get
+// std::tuple_size_v
 #include <type_traits>
-// std::enable_if_t
+// std::decay_t
 #include <utility>
 // std::forward
 
+#include <cstddef>
+// std::size_t
+
 namespace fxx { namespace tuple {
 
 namespace detail {
 
-template<std::size_t Offset, class Pred, class Tuple>
-static constexpr std::enable_if_t<(std::tuple_size_v<Tuple> <= Offset), std::nullopt_t>
-first_impl(Pred&& pred, Tuple&& tuple) {
-    return std::nullopt;
-}
+// Recursive case.
+template<std::size_t Offset, std::size_t N>
+struct first_impl {
+    template<class Pred, class Tuple>
+    static constexpr std::optional<std::size_t> first(Pred&& pred, Tuple&& tuple) noexcept(
+        noexcept(static_cast<bool>(pred(detail::element<Offset>(std::forward<Tuple>(tuple)))))
+        && noexcept(first_impl<Offset + 1, N>::first(
+            std::forward<Pred>(pred),
+            std::forward<Tuple>(tuple)
+        ))
+    ) {
+        if (static_cast<bool>(pred(detail::element<Offset>(std::forward<Tuple>(tuple))))) {
+            return {Offset};
+        } else {
+            return first_impl<Offset + 1, N>::first(
+                std::forward<Pred>(pred),
+                std::forward<Tuple>(tuple)
+            );
+        }
+    }
+};
 
-template<std::size_t Offset, class Pred, class Tuple>
-static constexpr std::enable_if_t<(std::tuple_size_v<Tuple> > Offset), std::optional<std::size_t>>
-first_impl(Pred&& pred, Tuple&& tuple) {
-    if (static_cast<bool>(pred(std::get<Offset>(std::forward<Tuple>(tuple))))) {
-        return {Offset};
-    } else {
-        return first_impl<Offset + 1>(std::forward<Pred>(pred), std::forward<Tuple>(tuple));
+// Abort case.
+template<std::size_t N>
+struct first_impl<N, N> {
+    template<class Pred, class Tuple>
+    static constexpr std::nullopt_t first(Pred&&, Tuple&&) noexcept {
+        return std::nullopt;
     }
-}
+};
 
 } // namespace detail
 
@@ -50,8 +71,13 @@ first_impl(Pred&& pred, Tuple&& tuple) {
  */
 struct first_f {
     template<class Pred, class Tuple>
-    constexpr auto operator()(Pred&& pred, Tuple&& tuple) {
-        return detail::first_impl<0>(
+    constexpr auto operator()(Pred&& pred, Tuple&& tuple) noexcept(noexcept(
+        detail::first_impl<0, std::tuple_size_v<std::decay_t<Tuple>>>::first(
+            std::forward<Pred>(pred),
+            std::forward<Tuple>(tuple)
+        )
+    )) {
+        return detail::first_impl<0, std::tuple_size_v<std::decay_t<Tuple>>>::first(
             std::forward<Pred>(pred),
             std::forward<Tuple>(tuple)
         );
@@ -71,7 +97,8 @@ struct first_f {
  * @return  std::optional<std::size_t>
  */
 template<class Pred, class Tuple>
-constexpr auto first(Pred&& pred, Tuple&& tuple) {
+constexpr auto first(Pred&& pred, Tuple&& tuple)
+noexcept(noexcept(first_f{}(std::forward<Pred>(pred), std::forward<Tuple>(tuple)))) {
     return first_f{}(std::forward<Pred>(pred), std::forward<Tuple>(tuple));
 }
 
@@ -0,0 +1,120 @@
+/** Implements branchless std::tuple element matching.
+ *
+ * @file        tuple/first_branchless.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_FIRST_BRANCHLESS_H
+#define FXX_TUPLE_FIRST_BRANCHLESS_H
+#pragma once
+
+#include <fxx/cxx/countr_zero.h>
+// std::countr_zero
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <limits>
+// std::numeric_limits
+#include <optional>
+// std::(nullopt, optional)
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::decay_t
+#include <utility>
+// std::(forward, index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+#include <cstdint>
+// std::uint64_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Bitmask of all predicate results, with the result for the i-th element in the i-th bit.
+template<class Pred, class Tuple, std::size_t... Ns>
+static constexpr std::uint64_t first_mask(Pred& pred, Tuple&& tuple, std::index_sequence<Ns...>)
+noexcept((
+    noexcept(static_cast<bool>(pred(detail::element<Ns>(std::forward<Tuple>(tuple))))) && ...
+)) {
+    return (
+        std::uint64_t{0}
+        | ...
+        | (
+            static_cast<std::uint64_t>(
+                static_cast<bool>(pred(detail::element<Ns>(std::forward<Tuple>(tuple))))
+            ) << Ns
+        )
+    );
+}
+
+template<class Tuple>
+using first_mask_seq = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+} // namespace detail
+
+/** Functor for matching std::tuple elements without branching on the predicate results.
+ *
+ * Unlike first_f, all predicates are evaluated unconditionally. The results are packed into a
+ * bitmask, and the index of the first match is obtained by counting the trailing zeros. This avoids
+ * a data-dependent branch per element, which pays off when the results are hard to predict.
+ *
+ * @warning Every predicate is evaluated, even after a match has been found. This is only
+ *          beneficial when the predicate is cheap, and only equivalent to first_f when it has no
+ *          side effects.
+ * @warning Limited to tuples of at most 64 elements.
+ */
+struct first_branchless_f {
+    template<class Pred, class Tuple>
+    constexpr auto operator()(Pred&& pred, Tuple&& tuple) noexcept(noexcept(
+        detail::first_mask(pred, std::forward<Tuple>(tuple), detail::first_mask_seq<Tuple>{})
+    )) {
+        constexpr auto size = std::tuple_size_v<std::decay_t<Tuple>>;
+        static_assert(
+            size <= std::numeric_limits<std::uint64_t>::digits,
+            "Tuple is too large for branchless matching!"
+        );
+
+        if constexpr (size == 0) {
+            return std::nullopt;
+        } else {
+            const auto mask = detail::first_mask(
+                pred,
+                std::forward<Tuple>(tuple),
+                detail::first_mask_seq<Tuple>{}
+            );
+            return mask == 0
+                ? std::optional<std::size_t>{}
+                : std::optional<std::size_t>{static_cast<std::size_t>(std::countr_zero(mask))};
+        }
+    }
+};
+
+/** Match std::tuple elements using a predicate, without branching on the predicate results.
+ *
+ * See first_branchless_f for more details.
+ *
+ * @tparam  Pred    Predicate type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    pred    Predicate.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  std::optional<std::size_t>
+ */
+template<class Pred, class Tuple>
+constexpr auto first_branchless(Pred&& pred, Tuple&& tuple)
+noexcept(noexcept(first_branchless_f{}(std::forward<Pred>(pred), std::forward<Tuple>(tuple)))) {
+    return first_branchless_f{}(std::forward<Pred>(pred), std::forward<Tuple>(tuple));
+}
+
+} } // namespace fxx::tuple
+
+#endif
@@ -14,32 +14,42 @@
 #pragma once
 
 #include <tuple>
-// std::tuple_cat
+// std::tuple_size_v
+#include <type_traits>
+// std::decay_t
 #include <utility>
-// std::forward
+// std::(forward, index_sequence, make_index_sequence)
 
 #include <cstddef>
 // std::size_t
 
+#include <fxx/tuple/pick.h>
+// fxx::tuple::pick_f
+
 namespace fxx { namespace tuple {
 
+namespace detail {
+
+template<class Tuple>
+using flip_seq = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+template<class Tuple, std::size_t... Ns>
+static constexpr auto flip_impl(Tuple&& tuple, std::index_sequence<Ns...>)
+noexcept(noexcept(pick_f<(sizeof...(Ns) - 1 - Ns)...>{}(std::forward<Tuple>(tuple)))) {
+    return pick_f<(sizeof...(Ns) - 1 - Ns)...>{}(std::forward<Tuple>(tuple));
+}
+
+} // namespace detail
+
 /** Functor for flipping std::tuples.
  *
  * @todo    Adapt documentation from fxx::meta::tuple_flip_t.
  */
 struct flip_f {
-    template<class Tuple, std::size_t N = std::tuple_size_v<Tuple>>
-    constexpr auto operator()(Tuple&& tuple) noexcept {
-        if constexpr (N == 0) {
-            return std::tuple<>{};
-        } else {
-            return std::tuple_cat(
-                std::tuple<std::tuple_element_t<N-1, Tuple>>(
-                    std::get<N-1>(std::forward<Tuple>(tuple))
-                ),
-                flip_f{}.operator()<Tuple, N-1>(std::forward<Tuple>(tuple))
-            );
-        }
+    template<class Tuple>
+    constexpr auto operator()(Tuple&& tuple)
+    noexcept(noexcept(detail::flip_impl(std::forward<Tuple>(tuple), detail::flip_seq<Tuple>{}))) {
+        return detail::flip_impl(std::forward<Tuple>(tuple), detail::flip_seq<Tuple>{});
     }
 };
 
@@ -54,7 +64,7 @@ struct flip_f {
  * @return  Return tuple.
  */
 template<class Tuple>
-constexpr auto flip(Tuple&& tuple) noexcept {
+constexpr auto flip(Tuple&& tuple) noexcept(noexcept(flip_f{}(std::forward<Tuple>(tuple)))) {
     return flip_f{}(std::forward<Tuple>(tuple));
 }
 
@@ -13,8 +13,15 @@
 #define FXX_TUPLE_FOLD_H
 #pragma once
 
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
 #include <tuple>
-// std::(get, tuple_element_t, tuple_size_v)
+// std::tuple_size_v
+#include <type_traits>
+// std::decay_t
 #include <utility>
 // std::forward
 
@@ -26,14 +33,23 @@ namespace detail {
 template<std::size_t N>
 struct fold_impl {
     template<class Fn, class Init, class Tuple>
-    static constexpr auto fold(Fn&& fn, Init&& init, Tuple&& tuple) -> decltype(
+    static constexpr auto fold(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+        fn(
+            fold_impl<N-1>::fold(
+                std::forward<Fn>(fn),
+                std::forward<Init>(init),
+                std::forward<Tuple>(tuple)
+            ),
+            detail::element<N-1>(std::forward<Tuple>(tuple))
+        )
+    )) -> decltype(
         fn(
             fold_impl<N-1>::fold(
                 std::forward<Fn>(fn),
                 std::forward<Init>(init),
                 std::forward<Tuple>(tuple)
             ),
-            std::get<N-1>(std::forward<Tuple>(tuple))
+            detail::element<N-1>(std::forward<Tuple>(tuple))
         )
     ) {
         return fn(
@@ -42,7 +58,7 @@ struct fold_impl {
                 std::forward<Init>(init),
                 std::forward<Tuple>(tuple)
             ),
-            std::get<N-1>(std::forward<Tuple>(tuple))
+            detail::element<N-1>(std::forward<Tuple>(tuple))
         );
     }
 };
@@ -51,7 +67,8 @@ struct fold_impl {
 template<>
 struct fold_impl<0> {
     template<class Fn, class Init, class Tuple>
-    static constexpr Init fold(Fn&&, Init&& init, Tuple&& tuple) {
+    static constexpr Init fold(Fn&&, Init&& init, Tuple&&)
+    noexcept(std::is_nothrow_convertible_v<Init&&, Init>) {
         return std::forward<Init>(init);
     }
 };
@@ -63,15 +80,24 @@ struct fold_impl<0> {
  * @todo    Adapt documentation from fxx::meta::tuple_fold_t.
  */
 struct fold_f {
+    template<class Tuple>
+    static constexpr auto size = std::tuple_size_v<std::decay_t<Tuple>>;
+
     template<class Fn, class Init, class Tuple>
-    constexpr auto operator()(Fn&& fn, Init&& init, Tuple&& tuple) -> decltype(
-        detail::fold_impl<std::tuple_size_v<Tuple>>::fold(
+    constexpr auto operator()(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+        detail::fold_impl<size<Tuple>>::fold(
+            std::forward<Fn>(fn),
+            std::forward<Init>(init),
+            std::forward<Tuple>(tuple)
+        )
+    )) -> decltype(
+        detail::fold_impl<size<Tuple>>::fold(
             std::forward<Fn>(fn),
             std::forward<Init>(init),
             std::forward<Tuple>(tuple)
         )
     ) {
-        return detail::fold_impl<std::tuple_size_v<Tuple>>::fold(
+        return detail::fold_impl<size<Tuple>>::fold(
             std::forward<Fn>(fn),
             std::forward<Init>(init),
             std::forward<Tuple>(tuple)
@@ -94,7 +120,9 @@ struct fold_f {
  * @return  Result.
  */
 template<class Fn, class Init, class Tuple>
-constexpr auto fold(Fn&& fn, Init&& init, Tuple&& tuple) -> decltype(
+constexpr auto fold(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+    fold_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple))
+)) -> decltype(
     fold_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple))
 ) {
     return fold_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple));
@@ -0,0 +1,134 @@
+/** Implements balanced tree-shaped std::tuple folding.
+ *
+ * @file        tuple/fold_tree.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_FOLD_TREE_H
+#define FXX_TUPLE_FOLD_TREE_H
+#pragma once
+
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+
+#include <fxx/tuple/reduce_tree.h>
+// fxx::tuple::reduce_tree_f
+
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::decay_t
+#include <utility>
+// std::forward
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Recursive case.
+template<std::size_t N>
+struct fold_tree_impl {
+    template<class Fn, class Init, class Tuple>
+    static constexpr auto fold(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+        fn(
+            std::forward<Init>(init),
+            reduce_tree_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+        )
+    )) -> decltype(
+        fn(
+            std::forward<Init>(init),
+            reduce_tree_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+        )
+    ) {
+        return fn(
+            std::forward<Init>(init),
+            reduce_tree_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+        );
+    }
+};
+
+// Abort case.
+template<>
+struct fold_tree_impl<0> {
+    template<class Fn, class Init, class Tuple>
+    static constexpr Init fold(Fn&&, Init&& init, Tuple&&)
+    noexcept(std::is_nothrow_convertible_v<Init&&, Init>) {
+        return std::forward<Init>(init);
+    }
+};
+
+} // namespace detail
+
+/** Functor for folding a std::tuple in a balanced tree.
+ *
+ * The tuple elements are reduced in a balanced tree (see reduce_tree_f), and the result is combined
+ * with the initialization value from the left, as in fn(init, fn(fn(t_0, t_1), fn(t_2, t_3))).
+ *
+ * @todo    Adapt documentation from fxx::meta::tuple_fold_t.
+ *
+ * @warning Only equivalent to fold_f if the folding function is associative.
+ */
+struct fold_tree_f {
+    template<class Tuple>
+    using impl_t = detail::fold_tree_impl<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+    template<class Fn, class Init, class Tuple>
+    constexpr auto operator()(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+        impl_t<Tuple>::fold(
+            std::forward<Fn>(fn),
+            std::forward<Init>(init),
+            std::forward<Tuple>(tuple)
+        )
+    )) -> decltype(
+        impl_t<Tuple>::fold(
+            std::forward<Fn>(fn),
+            std::forward<Init>(init),
+            std::forward<Tuple>(tuple)
+        )
+    ) {
+        return impl_t<Tuple>::fold(
+            std::forward<Fn>(fn),
+            std::forward<Init>(init),
+            std::forward<Tuple>(tuple)
+        );
+    }
+};
+
+/** Fold a std::tuple in a balanced tree.
+ *
+ * @todo    Adapt documentation from fxx::meta::tuple_fold_t.
+ *
+ * @tparam  Fn      Folding function type.
+ * @tparam  Init    Initialization value type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    fn      Associative folding function.
+ * @param   [in]    init    Initialization value.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result.
+ */
+template<class Fn, class Init, class Tuple>
+constexpr auto fold_tree(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+    fold_tree_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple))
+)) -> decltype(
+    fold_tree_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple))
+) {
+    return fold_tree_f{}(
+        std::forward<Fn>(fn),
+        std::forward<Init>(init),
+        std::forward<Tuple>(tuple)
+    );
+}
+
+} } // namespace fxx::tuple
+
+#endif
@@ -0,0 +1,164 @@
+/** Implements short-circuiting std::tuple folding.
+ *
+ * @file        tuple/fold_until.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_FOLD_UNTIL_H
+#define FXX_TUPLE_FOLD_UNTIL_H
+#pragma once
+
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <optional>
+// std::(nullopt, optional)
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::(decay_t, is_nothrow_move_assignable_v, is_nothrow_move_constructible_v)
+#include <utility>
+// std::(as_const, declval, forward, move, pair)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Recursive case.
+template<std::size_t Offset, std::size_t N>
+struct fold_until_impl {
+    template<class Fn, class Acc, class Tuple>
+    static constexpr std::optional<std::size_t> fold(Fn& fn, Acc& acc, Tuple&& tuple) noexcept(
+        noexcept(fn(std::as_const(acc), detail::element<Offset>(std::forward<Tuple>(tuple))))
+        && std::is_nothrow_move_assignable_v<Acc>
+        && noexcept(fold_until_impl<Offset + 1, N>::fold(fn, acc, std::forward<Tuple>(tuple)))
+    ) {
+        auto next = fn(std::as_const(acc), detail::element<Offset>(std::forward<Tuple>(tuple)));
+        if (!next) {
+            return {Offset};
+        }
+
+        acc = *std::move(next);
+        return fold_until_impl<Offset + 1, N>::fold(fn, acc, std::forward<Tuple>(tuple));
+    }
+};
+
+// Abort case.
+template<std::size_t N>
+struct fold_until_impl<N, N> {
+    template<class Fn, class Acc, class Tuple>
+    static constexpr std::optional<std::size_t> fold(Fn&, Acc&, Tuple&&) noexcept {
+        return std::nullopt;
+    }
+};
+
+} // namespace detail
+
+/** Functor for short-circuiting folding of a std::tuple, reporting where it stopped.
+ *
+ * Folds the tuple from the left like fold_f, but the folding function returns an optional-like
+ * value (i.e. std::optional) holding the next accumulator. Returning an empty value stops the fold
+ * immediately, so the function is never invoked on any of the remaining elements.
+ *
+ * The result is a std::pair of the index of the element that stopped the fold (or std::nullopt if
+ * all elements were visited), and the accumulator before that element.
+ *
+ * @note    As the fold may stop at any element, the accumulator has the same type
+ *          (`std::decay_t<Init>`) at every step.
+ */
+struct first_fold_f {
+    template<class Tuple>
+    using impl_t = detail::fold_until_impl<0, std::tuple_size_v<std::decay_t<Tuple>>>;
+
+    template<class Fn, class Init, class Tuple, class Acc = std::decay_t<Init>>
+    constexpr auto operator()(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(
+        std::is_nothrow_convertible_v<Init&&, Acc>
+        && std::is_nothrow_move_constructible_v<Acc>
+        && noexcept(impl_t<Tuple>::fold(fn, std::declval<Acc&>(), std::forward<Tuple>(tuple)))
+    ) {
+        std::pair<std::optional<std::size_t>, Acc> result{std::nullopt, std::forward<Init>(init)};
+        result.first = impl_t<Tuple>::fold(fn, result.second, std::forward<Tuple>(tuple));
+        return result;
+    }
+};
+
+/** Fold a std::tuple until the folding function signals to stop, reporting where it stopped.
+ *
+ * See first_fold_f for more details.
+ *
+ * @tparam  Fn      Folding function type.
+ * @tparam  Init    Initialization value type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    fn      Folding function.
+ * @param   [in]    init    Initialization value.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  std::pair<std::optional<std::size_t>, std::decay_t<Init>>
+ */
+template<class Fn, class Init, class Tuple>
+constexpr auto first_fold(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+    first_fold_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple))
+)) {
+    return first_fold_f{}(
+        std::forward<Fn>(fn),
+        std::forward<Init>(init),
+        std::forward<Tuple>(tuple)
+    );
+}
+
+/** Functor for short-circuiting folding of a std::tuple.
+ *
+ * Like first_fold_f, but only returns the accumulator.
+ */
+struct fold_until_f {
+    template<class Fn, class Init, class Tuple>
+    constexpr auto operator()(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+        first_fold_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple))
+    ) && std::is_nothrow_move_constructible_v<std::decay_t<Init>>) {
+        return first_fold_f{}(
+            std::forward<Fn>(fn),
+            std::forward<Init>(init),
+            std::forward<Tuple>(tuple)
+        ).second;
+    }
+};
+
+/** Fold a std::tuple until the folding function signals to stop.
+ *
+ * See first_fold_f for more details.
+ *
+ * @tparam  Fn      Folding function type.
+ * @tparam  Init    Initialization value type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    fn      Folding function.
+ * @param   [in]    init    Initialization value.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  std::decay_t<Init>
+ */
+template<class Fn, class Init, class Tuple>
+constexpr auto fold_until(Fn&& fn, Init&& init, Tuple&& tuple) noexcept(noexcept(
+    fold_until_f{}(std::forward<Fn>(fn), std::forward<Init>(init), std::forward<Tuple>(tuple))
+)) {
+    return fold_until_f{}(
+        std::forward<Fn>(fn),
+        std::forward<Init>(init),
+        std::forward<Tuple>(tuple)
+    );
+}
+
+} } // namespace fxx::tuple
+
+#endif
@@ -0,0 +1,73 @@
+/** Implements invoking a function on all std::tuple elements.
+ *
+ * @file        tuple/for_each.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_FOR_EACH_H
+#define FXX_TUPLE_FOR_EACH_H
+#pragma once
+
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::decay_t
+#include <utility>
+// std::(declval, forward, index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+template<class Fn, class Tuple, std::size_t... Ns>
+static constexpr void for_each_impl(Fn& fn, Tuple&& tuple, std::index_sequence<Ns...>)
+noexcept((noexcept(fn(detail::element<Ns>(std::declval<Tuple>()))) && ...)) {
+    (static_cast<void>(fn(detail::element<Ns>(std::forward<Tuple>(tuple)))), ...);
+}
+
+} // namespace detail
+
+/** Functor for invoking a function on all std::tuple elements.
+ *
+ * Unlike fxx::tuple::map_f, the results are discarded and no tuple is constructed. The function
+ * is invoked on the elements in order.
+ */
+struct for_each_f {
+    template<class Tuple>
+    using seq_t = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+    template<class Fn, class Tuple>
+    constexpr void operator()(Fn&& fn, Tuple&& tuple)
+    noexcept(noexcept(detail::for_each_impl(fn, std::forward<Tuple>(tuple), seq_t<Tuple>{}))) {
+        detail::for_each_impl(fn, std::forward<Tuple>(tuple), seq_t<Tuple>{});
+    }
+};
+
+/** Invoke a function on all std::tuple elements.
+ *
+ * @tparam  Fn      Function type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    fn      Function.
+ * @param   [in]    tuple   Input tuple.
+ */
+template<class Fn, class Tuple>
+constexpr void for_each(Fn&& fn, Tuple&& tuple)
+noexcept(noexcept(for_each_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple)))) {
+    for_each_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple));
+}
+
+} } // namespace fxx::tuple
+
+#endif
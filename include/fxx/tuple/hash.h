@@ -0,0 +1,240 @@
+/** Implements std::tuple hashing.
+ *
+ * @file        tuple/hash.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_HASH_H
+#define FXX_TUPLE_HASH_H
+#pragma once
+
+#include <fxx/tuple/bytewise.h>
+// fxx::tuple::detail::(bytewise_element_t, bytewise_pack, bytewise_size_v, is_bytewise_v)
+#include <fxx/tuple/fold.h>
+// fxx::tuple::fold_f
+
+#include <cstring>
+// std::memcpy
+#include <functional>
+// std::hash
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::decay_t
+#include <utility>
+// std::(declval, index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+#include <cstdint>
+// std::(uint32_t, uint64_t)
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Secret of the wyhash mixing function.
+static constexpr std::uint64_t hash_secret[] = {
+    0xa0761d6478bd642full,
+    0xe7037ed1a0b428dbull,
+    0x8ebc6af09c88c6e3ull,
+    0x589965cc75374cc3ull,
+};
+
+#ifdef __SIZEOF_INT128__
+// Extension integer type, marked so that it does not warn under -Wpedantic.
+__extension__ typedef unsigned __int128 hash_uint128_t;
+#endif
+
+// Multiply to 128 bits, and return the low and high halves in place.
+static constexpr void hash_mum(std::uint64_t& a, std::uint64_t& b) noexcept {
+#ifdef __SIZEOF_INT128__
+    const auto r = static_cast<hash_uint128_t>(a) * b;
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    const std::uint64_t ha = a >> 32, hb = b >> 32, la = a & 0xffffffffu, lb = b & 0xffffffffu;
+    const std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const std::uint64_t t = rl + (rm0 << 32);
+    const std::uint64_t lo = t + (rm1 << 32);
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+#endif
+}
+
+// Multiply to 128 bits, and fold the halves.
+static constexpr std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b) noexcept {
+    hash_mum(a, b);
+    return a ^ b;
+}
+
+static inline std::uint64_t hash_read8(const unsigned char* p) noexcept {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline std::uint64_t hash_read4(const unsigned char* p) noexcept {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Hash a byte buffer in one pass (wyhash, final version 4).
+static inline std::uint64_t hash_bytes(
+    const unsigned char* p,
+    std::size_t len,
+    std::uint64_t seed
+) noexcept {
+    seed ^= hash_mix(seed ^ hash_secret[0], hash_secret[1]);
+
+    std::uint64_t a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            const std::size_t k = (len >> 3) << 2;
+            a = (hash_read4(p) << 32) | hash_read4(p + k);
+            b = (hash_read4(p + len - 4) << 32) | hash_read4(p + len - 4 - k);
+        } else if (len > 0) {
+            a = (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[len >> 1]} << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        std::size_t i = len;
+        if (i > 48) {
+            std::uint64_t seed1 = seed, seed2 = seed;
+            do {
+                seed = hash_mix(hash_read8(p) ^ hash_secret[1], hash_read8(p + 8) ^ seed);
+                seed1 = hash_mix(hash_read8(p + 16) ^ hash_secret[2], hash_read8(p + 24) ^ seed1);
+                seed2 = hash_mix(hash_read8(p + 32) ^ hash_secret[3], hash_read8(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16) {
+            seed = hash_mix(hash_read8(p) ^ hash_secret[1], hash_read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = hash_read8(p + i - 16);
+        b = hash_read8(p + i - 8);
+    }
+
+    a ^= hash_secret[1];
+    b ^= seed;
+    hash_mum(a, b);
+    return hash_mix(a ^ hash_secret[0] ^ len, b ^ hash_secret[1]);
+}
+
+// Pack the object representations of all elements, and hash them in one pass.
+template<class Tuple, std::size_t... Ns>
+static inline std::uint64_t bytewise_hash(
+    const Tuple& tuple,
+    std::uint64_t seed,
+    std::index_sequence<Ns...> seq
+) noexcept {
+    constexpr std::size_t size = bytewise_size_v<Tuple>;
+
+    unsigned char bytes[size > 0 ? size : 1];
+    bytewise_pack(tuple, bytes, seq);
+
+    return hash_bytes(bytes, size, seed);
+}
+
+// Combines the accumulated hash with the std::hash of the next element.
+struct hash_combine {
+    template<class T>
+    std::uint64_t operator()(std::uint64_t acc, const T& x) const
+    noexcept(noexcept(std::hash<bytewise_element_t<T>>{}(x))) {
+        const auto h = static_cast<std::uint64_t>(std::hash<bytewise_element_t<T>>{}(x));
+        return hash_mix(acc ^ hash_secret[0], h ^ hash_secret[1]);
+    }
+};
+
+} // namespace detail
+
+/** Functor for hashing std::tuple elements.
+ *
+ * When the object representation of every element type is unique (e.g. integers, enums and
+ * unpadded trivial structs), the elements are packed into a buffer without padding and hashed in
+ * one pass with wyhash. Otherwise, the std::hash of every element is combined by folding with the
+ * wyhash mixing function.
+ *
+ * Both paths have good avalanche behaviour, and do not distinguish between references and values:
+ * `hash(std::tie(a, b)) == hash(std::make_tuple(a, b))`.
+ *
+ * @warning Hashes are not portable between platforms of different endianness, and are not stable
+ *          across versions of this library.
+ */
+struct hash_f {
+    template<class Tuple>
+    std::uint64_t operator()(const Tuple& tuple, std::uint64_t seed = 0) const
+    noexcept(detail::is_bytewise_v<Tuple> || noexcept(
+        fold_f{}(detail::hash_combine{}, std::declval<std::uint64_t>(), tuple)
+    )) {
+        if constexpr (detail::is_bytewise_v<Tuple>) {
+            return detail::bytewise_hash(
+                tuple,
+                seed,
+                std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>{}
+            );
+        } else {
+            const std::uint64_t init = detail::hash_mix(
+                seed ^ detail::hash_secret[0],
+                detail::hash_secret[1]
+            );
+            return fold_f{}(detail::hash_combine{}, init, tuple);
+        }
+    }
+};
+
+/** Hash std::tuple elements.
+ *
+ * See hash_f for more details.
+ *
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    tuple   Input tuple.
+ * @param   [in]    seed    Seed.
+ *
+ * @return  std::uint64_t
+ */
+template<class Tuple>
+std::uint64_t hash(const Tuple& tuple, std::uint64_t seed = 0)
+noexcept(noexcept(hash_f{}(tuple, seed))) {
+    return hash_f{}(tuple, seed);
+}
+
+/** std::hash compatible adapter for hash_f.
+ *
+ * @code{.cpp}
+ * std::unordered_map<std::tuple<std::uint64_t, std::uint32_t>, int, fxx::tuple::hasher<>> map;
+ * @endcode
+ *
+ * @tparam  Tuple   Key tuple type, or void to hash any tuple.
+ */
+template<class Tuple = void>
+struct hasher {
+    std::size_t operator()(const Tuple& tuple) const noexcept(noexcept(hash_f{}(tuple))) {
+        return static_cast<std::size_t>(hash_f{}(tuple));
+    }
+};
+
+template<>
+struct hasher<void> {
+    template<class Tuple>
+    std::size_t operator()(const Tuple& tuple) const noexcept(noexcept(hash_f{}(tuple))) {
+        return static_cast<std::size_t>(hash_f{}(tuple));
+    }
+};
+
+} } // namespace fxx::tuple
+
+#endif
@@ -13,22 +13,43 @@
 #define FXX_TUPLE_MAP_H
 #pragma once
 
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
 #include <tuple>
-// std::get
+// std::(tuple, tuple_size_v)
+#include <type_traits>
+// std::decay_t
 #include <utility>
-// std::(forward, index_sequence, make_index_sequence)
+// std::(declval, forward, index_sequence, make_index_sequence)
 
 namespace fxx { namespace tuple {
 
 namespace detail {
 
+// Indicates whether mapping elements can not throw.
+template<class Fn, class Tuple, std::size_t... Ns>
+static constexpr bool is_nothrow_map_v = (
+    (
+        noexcept(std::declval<Fn>()(detail::element<Ns>(std::declval<Tuple>())))
+        && std::is_nothrow_convertible_v<
+            decltype(std::declval<Fn>()(detail::element<Ns>(std::declval<Tuple>()))),
+            decltype(std::declval<Fn>()(detail::element<Ns>(std::declval<Tuple>())))
+        >
+    ) && ...
+);
+
 template<class Fn, class Tuple, std::size_t... Ns>
-static constexpr auto map_impl(Fn&& fn, Tuple&& tuple, std::index_sequence<Ns...>) {
+static constexpr auto map_impl(Fn&& fn, Tuple&& tuple, std::index_sequence<Ns...>)
+noexcept(is_nothrow_map_v<Fn&, Tuple, Ns...>) {
+    // Braced initialization evaluates the calls in order.
     return std::tuple<
-        decltype(fn(std::declval<std::tuple_element_t<Ns, Tuple>>()))...
-    >(
-        fn(std::get<Ns>(std::forward<Tuple>(tuple)))...
-    );
+        decltype(fn(detail::element<Ns>(std::forward<Tuple>(tuple))))...
+    >{
+        fn(detail::element<Ns>(std::forward<Tuple>(tuple)))...
+    };
 }
 
 } // namespace detail
@@ -38,13 +59,14 @@ static constexpr auto map_impl(Fn&& fn, Tuple&& tuple, std::index_sequence<Ns...
  * @todo    Adapt documentation from fxx::meta::tuple_map_t.
  */
 struct map_f {
+    template<class Tuple>
+    using seq_t = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
     template<class Fn, class Tuple>
-    constexpr auto operator()(Fn&& fn, Tuple&& tuple) {
-        return detail::map_impl(
-            std::forward<Fn>(fn),
-            std::forward<Tuple>(tuple),
-            std::make_index_sequence<std::tuple_size_v<Tuple>>{}
-        );
+    constexpr auto operator()(Fn&& fn, Tuple&& tuple) noexcept(noexcept(
+        detail::map_impl(std::forward<Fn>(fn), std::forward<Tuple>(tuple), seq_t<Tuple>{})
+    )) {
+        return detail::map_impl(std::forward<Fn>(fn), std::forward<Tuple>(tuple), seq_t<Tuple>{});
     }
 };
 
@@ -61,7 +83,8 @@ struct map_f {
  * @return  Result tuple.
  */
 template<class Fn, class Tuple>
-constexpr auto map(Fn&& fn, Tuple&& tuple) {
+constexpr auto map(Fn&& fn, Tuple&& tuple)
+noexcept(noexcept(map_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple)))) {
     return map_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple));
 }
 
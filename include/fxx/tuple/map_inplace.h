@@ -0,0 +1,96 @@
+/** Implements in-place std::tuple mapping.
+ *
+ * @file        tuple/map_inplace.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_MAP_INPLACE_H
+#define FXX_TUPLE_MAP_INPLACE_H
+#pragma once
+
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::(decay_t, is_void_v)
+#include <utility>
+// std::(declval, forward, index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Determine whether updating an element in place can not throw.
+template<class Fn, class T>
+static constexpr bool is_nothrow_map_inplace() {
+    if constexpr (std::is_void_v<decltype(std::declval<Fn&>()(std::declval<T&>()))>) {
+        return noexcept(std::declval<Fn&>()(std::declval<T&>()));
+    } else {
+        return noexcept(std::declval<T&>() = std::declval<Fn&>()(std::declval<T&>()));
+    }
+}
+
+template<class Fn, class T>
+static constexpr void map_inplace_element(Fn& fn, T& x)
+noexcept(is_nothrow_map_inplace<Fn, T>()) {
+    if constexpr (std::is_void_v<decltype(fn(x))>) {
+        fn(x);
+    } else {
+        x = fn(x);
+    }
+}
+
+template<class Fn, class Tuple, std::size_t... Ns>
+static constexpr void map_inplace_impl(Fn& fn, Tuple& tuple, std::index_sequence<Ns...>)
+noexcept((noexcept(map_inplace_element(fn, detail::element<Ns>(tuple))) && ...)) {
+    (map_inplace_element(fn, detail::element<Ns>(tuple)), ...);
+}
+
+} // namespace detail
+
+/** Functor for mapping std::tuple elements in place.
+ *
+ * For every element `x`, in order, `fn(x)` is invoked with `x` as an lvalue. If it returns void,
+ * it is expected to update `x` through the reference. Otherwise, the result is assigned to `x`.
+ * No tuple is constructed.
+ *
+ * @note    Tuples of references may be passed as rvalues, and update the referenced objects.
+ */
+struct map_inplace_f {
+    template<class Tuple>
+    using seq_t = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+    template<class Fn, class Tuple>
+    constexpr void operator()(Fn&& fn, Tuple&& tuple)
+    noexcept(noexcept(detail::map_inplace_impl(fn, tuple, seq_t<Tuple>{}))) {
+        detail::map_inplace_impl(fn, tuple, seq_t<Tuple>{});
+    }
+};
+
+/** Map std::tuple elements in place using a function.
+ *
+ * @tparam  Fn      Mapping function type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]        fn      Mapping function.
+ * @param   [in,out]    tuple   Input tuple.
+ */
+template<class Fn, class Tuple>
+constexpr void map_inplace(Fn&& fn, Tuple&& tuple)
+noexcept(noexcept(map_inplace_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple)))) {
+    map_inplace_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple));
+}
+
+} } // namespace fxx::tuple
+
+#endif
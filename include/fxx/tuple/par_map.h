@@ -0,0 +1,214 @@
+/** Implements parallel std::tuple mapping.
+ *
+ * @file        tuple/par_map.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_PAR_MAP_H
+#define FXX_TUPLE_PAR_MAP_H
+#pragma once
+
+#include <future>
+// std::(future, packaged_task)
+#include <memory>
+// std::make_shared
+#include <thread>
+// std::thread
+#include <tuple>
+// std::(get, tuple, tuple_size_v)
+#include <type_traits>
+// std::(conditional_t, decay_t, is_rvalue_reference_v, remove_reference_t)
+#include <utility>
+// std::(declval, forward, index_sequence, make_index_sequence)
+#include <vector>
+// std::vector
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+/** Executor that runs every task on a new std::thread.
+ *
+ * All threads are joined when the executor is destroyed.
+ */
+class thread_executor {
+public:
+    thread_executor() = default;
+    thread_executor(const thread_executor&) = delete;
+    thread_executor& operator=(const thread_executor&) = delete;
+
+    ~thread_executor() {
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    template<class Task>
+    void operator()(Task&& task) {
+        m_threads.emplace_back(std::forward<Task>(task));
+    }
+
+private:
+    std::vector<std::thread> m_threads;
+};
+
+/** Executor that runs every task immediately on the calling thread. */
+struct inline_executor {
+    template<class Task>
+    void operator()(Task&& task) {
+        std::forward<Task>(task)();
+    }
+};
+
+namespace detail {
+
+// Result type of mapping a single element, where rvalue references are stored as values.
+template<class Fn, class Tuple, std::size_t I>
+using par_map_result_t = std::conditional_t<
+    std::is_rvalue_reference_v<decltype(std::declval<Fn&>()(std::get<I>(std::declval<Tuple>())))>,
+    std::remove_reference_t<decltype(std::declval<Fn&>()(std::get<I>(std::declval<Tuple>())))>,
+    decltype(std::declval<Fn&>()(std::get<I>(std::declval<Tuple>())))
+>;
+
+// Submit a single element invocation to the executor.
+template<std::size_t I, class Tuple, class Executor, class Fn>
+static auto par_map_submit(Executor& executor, Fn& fn, std::remove_reference_t<Tuple>& tuple) {
+    using result_t = par_map_result_t<Fn, Tuple, I>;
+
+    // Executors may require copyable tasks, so the move-only task is shared.
+    auto task = std::make_shared<std::packaged_task<result_t()>>([&fn, &tuple]() -> result_t {
+        return fn(std::get<I>(std::forward<Tuple>(tuple)));
+    });
+    auto future = task->get_future();
+    executor([task]() { (*task)(); });
+    return future;
+}
+
+template<class Executor, class Fn, class Tuple, std::size_t... Ns>
+static auto par_map_impl(Executor& executor, Fn& fn, Tuple&& tuple, std::index_sequence<Ns...>) {
+    std::tuple<std::future<par_map_result_t<Fn, Tuple, Ns>>...> futures;
+
+    // If submitting fails, the tasks already submitted must finish before the tuple goes away.
+    try {
+        ((std::get<Ns>(futures) = par_map_submit<Ns, Tuple>(executor, fn, tuple)), ...);
+    } catch (...) {
+        ((std::get<Ns>(futures).valid() ? std::get<Ns>(futures).wait() : void()), ...);
+        throw;
+    }
+
+    // Join all tasks, then collect the results in order, so that the exception from the lowest
+    // index propagates regardless of scheduling.
+    (std::get<Ns>(futures).wait(), ...);
+    return std::tuple<par_map_result_t<Fn, Tuple, Ns>...>{std::get<Ns>(futures).get()...};
+}
+
+template<class Executor, class Fn, class Tuple, std::size_t... Ns>
+static void par_for_each_impl(
+    Executor& executor,
+    Fn& fn,
+    Tuple&& tuple,
+    std::index_sequence<Ns...>
+) {
+    std::tuple<std::future<par_map_result_t<Fn, Tuple, Ns>>...> futures;
+
+    try {
+        ((std::get<Ns>(futures) = par_map_submit<Ns, Tuple>(executor, fn, tuple)), ...);
+    } catch (...) {
+        ((std::get<Ns>(futures).valid() ? std::get<Ns>(futures).wait() : void()), ...);
+        throw;
+    }
+
+    (std::get<Ns>(futures).wait(), ...);
+    (static_cast<void>(std::get<Ns>(futures).get()), ...);
+}
+
+} // namespace detail
+
+/** Functor for mapping std::tuple elements in parallel.
+ *
+ * Every element invocation is submitted to @p executor as a separate task, which is any callable
+ * accepting a nullary, copyable callable (e.g. fxx::tuple::thread_executor or a thread pool). All
+ * tasks are joined before the result tuple is built. If invocations throw, the exception of the
+ * lowest element index is rethrown.
+ *
+ * @warning @p fn may be invoked concurrently from multiple threads.
+ *
+ * @note    Results that are rvalue references are stored as values.
+ */
+struct par_map_f {
+    template<class Executor, class Fn, class Tuple>
+    auto operator()(Executor&& executor, Fn&& fn, Tuple&& tuple) {
+        return detail::par_map_impl(
+            executor,
+            fn,
+            std::forward<Tuple>(tuple),
+            std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>{}
+        );
+    }
+};
+
+/** Map std::tuple elements in parallel.
+ *
+ * @tparam  Executor    Executor type.
+ * @tparam  Fn          Mapping function type.
+ * @tparam  Tuple       Input tuple type.
+ *
+ * @param   [in]    executor    Executor.
+ * @param   [in]    fn          Mapping function.
+ * @param   [in]    tuple       Input tuple.
+ *
+ * @return  Result tuple.
+ */
+template<class Executor, class Fn, class Tuple>
+auto par_map(Executor&& executor, Fn&& fn, Tuple&& tuple) {
+    return par_map_f{}(
+        std::forward<Executor>(executor),
+        std::forward<Fn>(fn),
+        std::forward<Tuple>(tuple)
+    );
+}
+
+/** Functor for invoking a function on all std::tuple elements in parallel.
+ *
+ * Behaves like fxx::tuple::par_map_f, but discards the results.
+ */
+struct par_for_each_f {
+    template<class Executor, class Fn, class Tuple>
+    void operator()(Executor&& executor, Fn&& fn, Tuple&& tuple) {
+        detail::par_for_each_impl(
+            executor,
+            fn,
+            std::forward<Tuple>(tuple),
+            std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>{}
+        );
+    }
+};
+
+/** Invoke a function on all std::tuple elements in parallel.
+ *
+ * @tparam  Executor    Executor type.
+ * @tparam  Fn          Function type.
+ * @tparam  Tuple       Input tuple type.
+ *
+ * @param   [in]    executor    Executor.
+ * @param   [in]    fn          Function.
+ * @param   [in]    tuple       Input tuple.
+ */
+template<class Executor, class Fn, class Tuple>
+void par_for_each(Executor&& executor, Fn&& fn, Tuple&& tuple) {
+    par_for_each_f{}(
+        std::forward<Executor>(executor),
+        std::forward<Fn>(fn),
+        std::forward<Tuple>(tuple)
+    );
+}
+
+} } // namespace fxx::tuple
+
+#endif
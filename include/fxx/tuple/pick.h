@@ -13,51 +13,59 @@
 #define FXX_TUPLE_PICK_H
 #pragma once
 
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
 #include <tuple>
-// std::(tuple, tuple_cat)
+// std::(tuple, tuple_element_t)
+#include <type_traits>
+// std::decay_t
 #include <utility>
-// std::forward
+// std::(declval, forward)
 
 #include <cstddef>
 // std::size_t
 
 namespace fxx { namespace tuple {
 
+namespace detail {
+
+// Indicates whether picking elements can not throw.
+template<class Tuple, std::size_t... Ns>
+static constexpr bool is_nothrow_pick_v = (
+    std::is_nothrow_convertible_v<
+        decltype(detail::element<Ns>(std::declval<Tuple>())),
+        std::tuple_element_t<Ns, std::decay_t<Tuple>>
+    > && ...
+);
+
+} // namespace detail
+
 /** Functor for picking from a std::tuple.
+ *
+ * The result tuple is constructed exactly once, directly from the selected input elements, so that
+ * every picked element is copied (or moved, if @p Tuple is an rvalue) once.
  *
  * @todo    Adapt documentation from fxx::meta::tuple_pick_t.
  *
+ * @warning When picking the same index multiple times from an rvalue, all but the first pick of
+ *          that element will observe a moved-from value.
+ *
  * @tparam  Ns      Picking indices.
  */
-// Forward declaration.
 template<std::size_t... Ns>
-struct pick_f {};
-
-/// @cond
-// Recursive case.
-template<std::size_t Head, std::size_t... Tail>
-struct pick_f<Head, Tail...> {
+struct pick_f {
     template<class Tuple>
-    constexpr auto operator()(Tuple&& tuple) noexcept {
-        return std::tuple_cat(
-            std::tuple<std::tuple_element_t<Head, Tuple>>(
-                std::get<Head>(std::forward<Tuple>(tuple))
-            ),
-            pick_f<Tail...>{}(std::forward<Tuple>(tuple))
+    constexpr auto operator()(Tuple&& tuple)
+    noexcept(detail::is_nothrow_pick_v<Tuple, Ns...>) {
+        return std::tuple<std::tuple_element_t<Ns, std::decay_t<Tuple>>...>(
+            detail::element<Ns>(std::forward<Tuple>(tuple))...
         );
     }
 };
 
-// Abort case.
-template<>
-struct pick_f<> {
-    template<class Tuple>
-    constexpr std::tuple<> operator()(Tuple&& tuple) noexcept {
-        return {};
-    }
-};
-/// @endcond
-
 /** Pick elements from a std::tuple.
  *
  * @todo    Adapt documentation from fxx::meta::tuple_pick_t.
@@ -67,7 +75,8 @@ struct pick_f<> {
  * @tparam  Ns      Picking indices.
  */
 template<std::size_t... Ns>
-static constexpr auto pick = [](auto&& tuple) constexpr noexcept {
+static constexpr auto pick = [](auto&& tuple) constexpr
+noexcept(noexcept(pick_f<Ns...>{}(std::forward<decltype(tuple)>(tuple)))) {
     return pick_f<Ns...>{}(std::forward<decltype(tuple)>(tuple));
 };
 
@@ -0,0 +1,384 @@
+/** Implements fused pipelines of std::tuple functors over ranges of rows.
+ *
+ * A pipeline is a chain of stages that ends in a terminal stage, for example:
+ *
+ * @code{.cpp}
+ * const auto total = fxx::tuple::pipe(
+ *     fxx::tuple::pipes::map([](auto x) { return x * 2; }),
+ *     fxx::tuple::pipes::filter([](const auto& row) { return std::get<0>(row) > 0; }),
+ *     fxx::tuple::pipes::fold([](int acc, const auto& row) { return acc + std::get<1>(row); }, 0)
+ * )(rows);
+ * @endcode
+ *
+ * Every row is pushed through all stages before the next row is read, so no intermediate range is
+ * materialized, and the per-row tuples only exist as locals of the fully inlined chain. Rows are
+ * read from contiguous ranges of tuples (e.g. std::span, std::vector) or from the columns of an
+ * fxx::soa_vector.
+ *
+ * The read loop is split into blocks with a constant trip count, followed by a tail loop, so that
+ * compilers can unroll and vectorize the inner loop. This is not cache blocking: every row is
+ * still read exactly once and in order, and no stage works on a block as a whole.
+ *
+ * @file        tuple/pipe.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_PIPE_H
+#define FXX_TUPLE_PIPE_H
+#pragma once
+
+#include <fxx/soa_vector.h>
+// fxx::soa_vector
+#include <fxx/tuple/filter.h>
+// fxx::tuple::filter_f
+#include <fxx/tuple/map.h>
+// fxx::tuple::map_f
+
+#include <algorithm>
+// std::max
+#include <iterator>
+// std::(data, size)
+#include <tuple>
+// std::(forward_as_tuple, get, make_tuple, tuple, tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::(decay_t, false_type, remove_reference_t, true_type)
+#include <utility>
+// std::(forward, index_sequence, make_index_sequence, move)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace pipes {
+
+/** Stage that maps the elements of every row, like fxx::tuple::map_f.
+ *
+ * @tparam  Fn  Mapping function type.
+ */
+template<class Fn>
+struct map_f {
+    Fn fn;
+
+    template<class Next, class Row>
+    constexpr void push(Next&& next, Row&& row) const {
+        next(fxx::tuple::map_f{}(fn, std::forward<Row>(row)));
+    }
+};
+
+/** Stage that replaces every row with the result of a function on the row.
+ *
+ * @tparam  Fn  Row function type.
+ */
+template<class Fn>
+struct transform_f {
+    Fn fn;
+
+    template<class Next, class Row>
+    constexpr void push(Next&& next, Row&& row) const {
+        next(fn(std::forward<Row>(row)));
+    }
+};
+
+/** Stage that only passes on the rows that match a predicate.
+ *
+ * @tparam  Pred    Row predicate type.
+ */
+template<class Pred>
+struct filter_f {
+    Pred pred;
+
+    template<class Next, class Row>
+    constexpr void push(Next&& next, Row&& row) const {
+        if (pred(static_cast<const std::remove_reference_t<Row>&>(row))) {
+            next(std::forward<Row>(row));
+        }
+    }
+};
+
+/** Stage that filters the elements of every row by type, like fxx::tuple::filter_f.
+ *
+ * @tparam  Pred    Predicate template.
+ */
+template<template<class> class Pred>
+struct filter_elements_f {
+    template<class Next, class Row>
+    constexpr void push(Next&& next, Row&& row) const {
+        next(fxx::tuple::filter_f<Pred>{}(std::forward<Row>(row)));
+    }
+};
+
+/** Terminal stage that folds all rows into an accumulator from the left.
+ *
+ * @tparam  Fn      Folding function type, invoked as `fn(acc, row)`.
+ * @tparam  Init    Accumulator type.
+ */
+template<class Fn, class Init>
+struct fold_f {
+    Fn fn;
+    Init init;
+
+    constexpr Init start() const { return init; }
+
+    template<class Row>
+    constexpr void consume(Init& acc, Row&& row) const {
+        acc = fn(std::move(acc), std::forward<Row>(row));
+    }
+
+    constexpr Init finish(Init&& acc) const { return std::move(acc); }
+};
+
+/** Terminal stage that invokes a function on all rows.
+ *
+ * @tparam  Fn  Function type.
+ */
+template<class Fn>
+struct for_each_f {
+    struct state {};
+
+    Fn fn;
+
+    constexpr state start() const noexcept { return {}; }
+
+    template<class Row>
+    constexpr void consume(state&, Row&& row) const {
+        fn(std::forward<Row>(row));
+    }
+
+    constexpr void finish(state&&) const noexcept {}
+};
+
+/** Map the elements of every row.
+ *
+ * See map_f for more details.
+ *
+ * @param   [in]    fn      Mapping function.
+ *
+ * @return  Stage.
+ */
+template<class Fn>
+constexpr map_f<std::decay_t<Fn>> map(Fn&& fn) {
+    return {std::forward<Fn>(fn)};
+}
+
+/** Replace every row with the result of a function on the row.
+ *
+ * See transform_f for more details.
+ *
+ * @param   [in]    fn      Row function.
+ *
+ * @return  Stage.
+ */
+template<class Fn>
+constexpr transform_f<std::decay_t<Fn>> transform(Fn&& fn) {
+    return {std::forward<Fn>(fn)};
+}
+
+/** Only pass on the rows that match a predicate.
+ *
+ * See filter_f for more details.
+ *
+ * @param   [in]    pred    Row predicate.
+ *
+ * @return  Stage.
+ */
+template<class Pred>
+constexpr filter_f<std::decay_t<Pred>> filter(Pred&& pred) {
+    return {std::forward<Pred>(pred)};
+}
+
+/** Filter the elements of every row by type.
+ *
+ * See filter_elements_f for more details.
+ *
+ * @tparam  Pred    Predicate template.
+ *
+ * @return  Stage.
+ */
+template<template<class> class Pred>
+constexpr filter_elements_f<Pred> filter() noexcept {
+    return {};
+}
+
+/** Fold all rows into an accumulator from the left.
+ *
+ * See fold_f for more details.
+ *
+ * @param   [in]    fn      Folding function.
+ * @param   [in]    init    Initial value.
+ *
+ * @return  Terminal stage.
+ */
+template<class Fn, class Init>
+constexpr fold_f<std::decay_t<Fn>, std::decay_t<Init>> fold(Fn&& fn, Init&& init) {
+    return {std::forward<Fn>(fn), std::forward<Init>(init)};
+}
+
+/** Invoke a function on all rows.
+ *
+ * See for_each_f for more details.
+ *
+ * @param   [in]    fn      Function.
+ *
+ * @return  Terminal stage.
+ */
+template<class Fn>
+constexpr for_each_f<std::decay_t<Fn>> for_each(Fn&& fn) {
+    return {std::forward<Fn>(fn)};
+}
+
+} // namespace pipes
+
+namespace detail {
+
+// Number of row bytes per block of the read loop, which only fixes the inner trip count.
+static constexpr std::size_t pipe_block_bytes = 16 * 1024;
+
+// Number of rows that are read per block.
+template<class Row>
+static constexpr std::size_t pipe_block_v = std::max<std::size_t>(
+    pipe_block_bytes / sizeof(Row),
+    1
+);
+
+template<class>
+struct is_pipe_soa : std::false_type {};
+
+template<class Tuple>
+struct is_pipe_soa<soa_vector<Tuple>> : std::true_type {};
+
+// Read all rows of a range, with the loop split into blocks and a tail, and push them into a sink.
+template<class Range, class Sink>
+constexpr void pipe_rows(Range& rows, Sink& sink) {
+    using value_t = std::remove_reference_t<decltype(*std::data(rows))>;
+    constexpr std::size_t block = pipe_block_v<value_t>;
+
+    value_t* const data = std::data(rows);
+    const std::size_t size = std::size(rows);
+
+    std::size_t first = 0;
+    for (; first + block <= size; first += block) {
+        value_t* const rows_block = data + first;
+        for (std::size_t i = 0; i < block; ++i) {
+            sink(rows_block[i]);
+        }
+    }
+    for (; first < size; ++first) {
+        sink(data[first]);
+    }
+}
+
+// Columns case.
+template<class Columns, class Sink, std::size_t... Ns>
+constexpr void pipe_columns(const Columns& columns, Sink& sink, std::index_sequence<Ns...>) {
+    using value_t = std::tuple<typename std::tuple_element_t<Ns, Columns>::value_type...>;
+    constexpr std::size_t block = pipe_block_v<value_t>;
+
+    const std::size_t size = std::get<0>(columns).size();
+
+    std::size_t first = 0;
+    for (; first + block <= size; first += block) {
+        const auto bases = std::make_tuple((std::get<Ns>(columns).data() + first)...);
+        for (std::size_t i = 0; i < block; ++i) {
+            sink(std::forward_as_tuple(std::get<Ns>(bases)[i]...));
+        }
+    }
+    for (; first < size; ++first) {
+        sink(std::forward_as_tuple(std::get<Ns>(columns)[first]...));
+    }
+}
+
+template<class Range, class Sink>
+constexpr void pipe_read(Range& rows, Sink& sink) {
+    if constexpr (is_pipe_soa<std::decay_t<Range>>::value) {
+        using columns_t = std::decay_t<decltype(rows.columns())>;
+        pipe_columns(
+            rows.columns(),
+            sink,
+            std::make_index_sequence<std::tuple_size_v<columns_t>>{}
+        );
+    } else {
+        pipe_rows(rows, sink);
+    }
+}
+
+} // namespace detail
+
+/** Fused chain of stages that is applied to every row of a range.
+ *
+ * Stages are applied in order. Every stage except the last one pushes zero or more rows into the
+ * next stage, and the last one is a terminal stage that consumes rows into a result.
+ *
+ * @tparam  Stages  Stage types, as created by the factories in fxx::tuple::pipes.
+ */
+template<class... Stages>
+class pipeline {
+    static_assert(sizeof...(Stages) > 0, "Pipeline requires a terminal stage!");
+
+    static constexpr std::size_t last = sizeof...(Stages) - 1;
+
+public:
+    constexpr explicit pipeline(std::tuple<Stages...> stages) : m_stages{std::move(stages)} {}
+
+    /** Apply the pipeline to all rows of a range.
+     *
+     * @param   [in]    rows    Contiguous range of tuples, or an fxx::soa_vector.
+     *
+     * @return  Result of the terminal stage.
+     */
+    template<class Range>
+    constexpr decltype(auto) operator()(Range&& rows) const {
+        const auto& terminal = std::get<last>(m_stages);
+
+        auto state = terminal.start();
+        auto sink = [this, &state](auto&& row) {
+            push<0>(state, std::forward<decltype(row)>(row));
+        };
+        detail::pipe_read(rows, sink);
+
+        return terminal.finish(std::move(state));
+    }
+
+private:
+    template<std::size_t I, class State, class Row>
+    constexpr void push(State& state, Row&& row) const {
+        if constexpr (I == last) {
+            std::get<I>(m_stages).consume(state, std::forward<Row>(row));
+        } else {
+            std::get<I>(m_stages).push(
+                [this, &state](auto&& next) {
+                    push<I + 1>(state, std::forward<decltype(next)>(next));
+                },
+                std::forward<Row>(row)
+            );
+        }
+    }
+
+    std::tuple<Stages...> m_stages;
+};
+
+/** Compose stages into a fused pipeline.
+ *
+ * See pipeline for more details.
+ *
+ * @tparam  Stages  Stage types.
+ *
+ * @param   [in]    stages  Stages, with a terminal stage last.
+ *
+ * @return  pipeline
+ */
+template<class... Stages>
+constexpr pipeline<std::decay_t<Stages>...> pipe(Stages&&... stages) {
+    return pipeline<std::decay_t<Stages>...>(
+        std::tuple<std::decay_t<Stages>...>(std::forward<Stages>(stages)...)
+    );
+}
+
+} } // namespace fxx::tuple
+
+#endif
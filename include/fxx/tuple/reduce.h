@@ -13,8 +13,15 @@
 #define FXX_TUPLE_REDUCE_H
 #pragma once
 
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
 #include <tuple>
-// std::(get, tuple_element_t, tuple_size_v)
+// std::(tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::(decay_t, remove_reference_t)
 #include <utility>
 // std::forward
 
@@ -28,15 +35,20 @@ struct reduce_impl {
     static_assert(N > 0, "0-Tuple is irreducible!");
 
     template<class Fn, class Tuple>
-    static constexpr auto reduce(Fn&& fn, Tuple&& tuple) -> decltype(
+    static constexpr auto reduce(Fn&& fn, Tuple&& tuple) noexcept(noexcept(
         fn(
             reduce_impl<N-1>::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple)),
-            std::get<N-1>(std::forward<Tuple>(tuple))
+            detail::element<N-1>(std::forward<Tuple>(tuple))
+        )
+    )) -> decltype(
+        fn(
+            reduce_impl<N-1>::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple)),
+            detail::element<N-1>(std::forward<Tuple>(tuple))
         )
     ) {
         return fn(
             reduce_impl<N-1>::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple)),
-            std::get<N-1>(std::forward<Tuple>(tuple))
+            detail::element<N-1>(std::forward<Tuple>(tuple))
         );
     }
 };
@@ -45,8 +57,14 @@ struct reduce_impl {
 template<>
 struct reduce_impl<1> {
     template<class Fn, class Tuple>
-    static constexpr std::tuple_element_t<0, Tuple> reduce(Fn&&, Tuple&& tuple) {
-        return std::get<0>(std::forward<Tuple>(tuple));
+    static constexpr std::tuple_element_t<0, std::remove_reference_t<Tuple>> reduce(
+        Fn&&,
+        Tuple&& tuple
+    ) noexcept(std::is_nothrow_convertible_v<
+        decltype(detail::element<0>(std::forward<Tuple>(tuple))),
+        std::tuple_element_t<0, std::remove_reference_t<Tuple>>
+    >) {
+        return detail::element<0>(std::forward<Tuple>(tuple));
     }
 };
 
@@ -57,14 +75,22 @@ struct reduce_impl<1> {
  * @todo    Adapt documentation from fxx::meta::tuple_reduce_t.
  */
 struct reduce_f {
+    template<class Tuple>
+    static constexpr auto size = std::tuple_size_v<std::decay_t<Tuple>>;
+
     template<class Fn, class Tuple>
-    constexpr auto operator()(Fn&& fn, Tuple&& tuple) -> decltype(
-        detail::reduce_impl<std::tuple_size_v<Tuple>>::reduce(
+    constexpr auto operator()(Fn&& fn, Tuple&& tuple) noexcept(noexcept(
+        detail::reduce_impl<size<Tuple>>::reduce(
+            std::forward<Fn>(fn),
+            std::forward<Tuple>(tuple)
+        )
+    )) -> decltype(
+        detail::reduce_impl<size<Tuple>>::reduce(
             std::forward<Fn>(fn),
             std::forward<Tuple>(tuple)
         )
     ) {
-        return detail::reduce_impl<std::tuple_size_v<Tuple>>::reduce(
+        return detail::reduce_impl<size<Tuple>>::reduce(
             std::forward<Fn>(fn),
             std::forward<Tuple>(tuple)
         );
@@ -84,7 +110,9 @@ struct reduce_f {
  * @return  Result.
  */
 template<class Fn, class Tuple>
-constexpr auto reduce(Fn&& fn, Tuple&& tuple) -> decltype(
+constexpr auto reduce(Fn&& fn, Tuple&& tuple) noexcept(noexcept(
+    reduce_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+)) -> decltype(
     reduce_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
 ) {
     return reduce_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple));
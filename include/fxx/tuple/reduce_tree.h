@@ -0,0 +1,129 @@
+/** Implements balanced tree-shaped std::tuple reduction.
+ *
+ * @file        tuple/reduce_tree.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_REDUCE_TREE_H
+#define FXX_TUPLE_REDUCE_TREE_H
+#pragma once
+
+#include <fxx/cxx/is_nothrow_convertible.h>
+// std::is_nothrow_convertible_v
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <tuple>
+// std::(tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::decay_t
+#include <utility>
+// std::forward
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Recursive case.
+template<std::size_t Start, std::size_t Length>
+struct reduce_tree_impl {
+    static_assert(Length > 0, "0-Tuple is irreducible!");
+
+    using lhs = reduce_tree_impl<Start, Length / 2>;
+    using rhs = reduce_tree_impl<Start + Length / 2, Length - Length / 2>;
+
+    template<class Fn, class Tuple>
+    static constexpr auto reduce(Fn&& fn, Tuple&& tuple) noexcept(noexcept(
+        fn(
+            lhs::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple)),
+            rhs::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+        )
+    )) -> decltype(
+        fn(
+            lhs::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple)),
+            rhs::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+        )
+    ) {
+        return fn(
+            lhs::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple)),
+            rhs::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+        );
+    }
+};
+
+// Abort case.
+template<std::size_t Start>
+struct reduce_tree_impl<Start, 1> {
+    template<class Tuple>
+    using element_t = std::tuple_element_t<Start, std::decay_t<Tuple>>;
+
+    template<class Fn, class Tuple>
+    static constexpr element_t<Tuple> reduce(Fn&&, Tuple&& tuple)
+    noexcept(std::is_nothrow_convertible_v<
+        decltype(detail::element<Start>(std::forward<Tuple>(tuple))),
+        element_t<Tuple>
+    >) {
+        return detail::element<Start>(std::forward<Tuple>(tuple));
+    }
+};
+
+} // namespace detail
+
+/** Functor for reducing a std::tuple in a balanced tree.
+ *
+ * Instead of the left-leaning chain fn(fn(fn(t_0, t_1), t_2), t_3) built by reduce_f, the tuple is
+ * split in halves that are reduced independently and then combined, as in
+ * fn(fn(t_0, t_1), fn(t_2, t_3)). This shortens the dependency chain between the invocations to
+ * log2(N), which allows the CPU to overlap them.
+ *
+ * @todo    Adapt documentation from fxx::meta::tuple_reduce_tree_t.
+ *
+ * @warning Only equivalent to reduce_f if the reduction function is associative. The evaluation
+ *          order of the two halves is unspecified.
+ */
+struct reduce_tree_f {
+    template<class Tuple>
+    using impl_t = detail::reduce_tree_impl<0, std::tuple_size_v<std::decay_t<Tuple>>>;
+
+    template<class Fn, class Tuple>
+    constexpr auto operator()(Fn&& fn, Tuple&& tuple) noexcept(noexcept(
+        impl_t<Tuple>::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+    )) -> decltype(
+        impl_t<Tuple>::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+    ) {
+        return impl_t<Tuple>::reduce(std::forward<Fn>(fn), std::forward<Tuple>(tuple));
+    }
+};
+
+/** Reduce a std::tuple in a balanced tree.
+ *
+ * @todo    Adapt documentation from fxx::meta::tuple_reduce_tree_t.
+ *
+ * @tparam  Fn      Reduction function type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    fn      Associative reduction function.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result.
+ */
+template<class Fn, class Tuple>
+constexpr auto reduce_tree(Fn&& fn, Tuple&& tuple) noexcept(noexcept(
+    reduce_tree_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+)) -> decltype(
+    reduce_tree_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple))
+) {
+    return reduce_tree_f{}(std::forward<Fn>(fn), std::forward<Tuple>(tuple));
+}
+
+} } // namespace fxx::tuple
+
+#endif
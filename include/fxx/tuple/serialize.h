@@ -0,0 +1,712 @@
+/** Implements binary serialization of std::tuples into contiguous buffers.
+ *
+ * The wire format is the concatenation of the elements in logical order, without padding:
+ *
+ *  - Trivially copyable elements (except pointers) are stored as their object representation.
+ *  - Nested std::tuples are stored as the concatenation of their elements.
+ *  - std::basic_strings of trivially copyable characters and std::vectors of serializable elements
+ *    are stored as a std::uint64_t element count, followed by their elements.
+ *
+ * Tuples that only contain trivially copyable elements are flat: they are written and read by
+ * copying the packed object representations at constant offsets. Tuples that contain nested tuples
+ * of such elements still have a compile-time serialized size, but are written and read field-wise,
+ * like all other tuples.
+ *
+ * @warning The format uses the native object representations, and is therefore only portable
+ *          between platforms with the same endianness and type sizes.
+ * @warning Trivially copyable elements with padding (e.g. structs) are stored including their
+ *          padding bytes, which are unspecified and may leak the previous contents of memory.
+ *
+ * @file        tuple/serialize.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_SERIALIZE_H
+#define FXX_TUPLE_SERIALIZE_H
+#pragma once
+
+#include <fxx/cxx/span.h>
+// std::span
+#include <fxx/tuple/bytewise.h>
+// fxx::tuple::detail::(bytewise_element_t, bytewise_pack, bytewise_unpack)
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <algorithm>
+// std::max
+#include <array>
+// std::array
+#include <cstring>
+// std::memcpy
+#include <iterator>
+// std::(data, size)
+#include <limits>
+// std::numeric_limits
+#include <memory>
+// std::addressof
+#include <new>
+// std::launder
+#include <optional>
+// std::(nullopt, optional)
+#include <string>
+// std::basic_string
+#include <tuple>
+// std::(tuple, tuple_element, tuple_element_t, tuple_size, tuple_size_v)
+#include <type_traits>
+// std::(conjunction, decay_t, enable_if_t, false_type, integral_constant, is_default_constructible,
+//       is_pointer_v, is_same_v, is_trivially_copyable, true_type, void_t)
+#include <utility>
+// std::(index_sequence, make_index_sequence)
+#include <vector>
+// std::vector
+
+#include <cstddef>
+// std::(byte, size_t)
+#include <cstdint>
+// std::(uint64_t, uintptr_t)
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Number of bytes consumed when reading fails.
+static constexpr std::size_t serial_error = std::numeric_limits<std::size_t>::max();
+
+// Indicates whether a type is a std::tuple, which is serialized element-wise.
+template<class>
+struct is_serial_tuple : std::false_type {};
+
+template<class... Ts>
+struct is_serial_tuple<std::tuple<Ts...>> : std::true_type {};
+
+// Dispatch case.
+template<class T, class = void>
+struct serial {};
+
+// Indicates whether a type can be serialized.
+template<class T, class = void>
+struct is_serializable : std::false_type {};
+
+template<class T>
+struct is_serializable<T, std::void_t<decltype(serial<T>::fixed)>> : std::true_type {};
+
+template<std::size_t N, class Tuple>
+using serial_element_t = bytewise_element_t<std::tuple_element_t<N, Tuple>>;
+
+// Flat case.
+template<class T>
+struct serial<T, std::enable_if_t<
+    std::is_trivially_copyable<T>::value && !std::is_pointer_v<T> && !is_serial_tuple<T>::value
+>> {
+    static constexpr bool fixed = true;
+    static constexpr bool flat = true;
+    static constexpr std::size_t min_size = sizeof(T);
+
+    static std::size_t size(const T&) noexcept { return sizeof(T); }
+
+    static std::size_t write(std::byte* out, const T& x) noexcept {
+        std::memcpy(out, std::addressof(x), sizeof(T));
+        return sizeof(T);
+    }
+
+    static std::size_t read(const std::byte* in, std::size_t n, T& x) noexcept {
+        if (n < sizeof(T)) {
+            return serial_error;
+        }
+        std::memcpy(std::addressof(x), in, sizeof(T));
+        return sizeof(T);
+    }
+};
+
+static inline std::size_t serial_write_count(std::byte* out, std::size_t count) noexcept {
+    const auto n = static_cast<std::uint64_t>(count);
+    std::memcpy(out, &n, sizeof(n));
+    return sizeof(n);
+}
+
+// Read an element count, and check that the remaining buffer can hold that many elements.
+static inline std::size_t serial_read_count(
+    const std::byte* in,
+    std::size_t n,
+    std::size_t min_size,
+    std::size_t& count
+) noexcept {
+    std::uint64_t c;
+    if (n < sizeof(c)) {
+        return serial_error;
+    }
+    std::memcpy(&c, in, sizeof(c));
+    if (c > (n - sizeof(c)) / std::max<std::size_t>(min_size, 1)) {
+        return serial_error;
+    }
+    count = static_cast<std::size_t>(c);
+    return sizeof(c);
+}
+
+// Dispatch case.
+template<class Tuple, class Seq = std::make_index_sequence<std::tuple_size_v<Tuple>>, class = void>
+struct serial_tuple {};
+
+// Variadic case.
+template<class Tuple, std::size_t... Ns>
+struct serial_tuple<Tuple, std::index_sequence<Ns...>, std::enable_if_t<
+    std::conjunction<is_serializable<serial_element_t<Ns, Tuple>>...>::value
+>> {
+    static constexpr bool fixed = (true && ... && serial<serial_element_t<Ns, Tuple>>::fixed);
+    // Nested tuples are not trivially copyable, and must not be copied as a whole.
+    static constexpr bool flat = (
+        true
+        && ...
+        && (
+            serial<serial_element_t<Ns, Tuple>>::flat
+            && !is_serial_tuple<serial_element_t<Ns, Tuple>>::value
+        )
+    );
+    static constexpr std::size_t min_size = (
+        std::size_t{0} + ... + serial<serial_element_t<Ns, Tuple>>::min_size
+    );
+
+    static std::size_t size(const Tuple& tuple) noexcept {
+        if constexpr (fixed) {
+            return min_size;
+        } else {
+            return (
+                std::size_t{0}
+                + ...
+                + serial<serial_element_t<Ns, Tuple>>::size(detail::element<Ns>(tuple))
+            );
+        }
+    }
+
+    static std::size_t write(std::byte* out, const Tuple& tuple) noexcept {
+        if constexpr (flat) {
+            bytewise_pack(
+                tuple,
+                reinterpret_cast<unsigned char*>(out),
+                std::index_sequence<Ns...>{}
+            );
+            return min_size;
+        } else {
+            std::size_t offset = 0;
+            ((
+                offset += serial<serial_element_t<Ns, Tuple>>::write(
+                    out + offset,
+                    detail::element<Ns>(tuple)
+                )
+            ), ...);
+            return offset;
+        }
+    }
+
+    static std::size_t read(const std::byte* in, std::size_t n, Tuple& tuple) {
+        if constexpr (flat) {
+            if (n < min_size) {
+                return serial_error;
+            }
+            bytewise_unpack(
+                reinterpret_cast<const unsigned char*>(in),
+                tuple,
+                std::index_sequence<Ns...>{}
+            );
+            return min_size;
+        } else {
+            // Stops at the first element that fails.
+            std::size_t offset = 0;
+            const bool ok = ((
+                read_one<Ns>(in, n, offset, detail::element<Ns>(tuple))
+            ) && ...);
+            return ok ? offset : serial_error;
+        }
+    }
+
+private:
+    template<std::size_t N, class T>
+    static bool read_one(const std::byte* in, std::size_t n, std::size_t& offset, T& x) {
+        const std::size_t r = serial<serial_element_t<N, Tuple>>::read(in + offset, n - offset, x);
+        if (r == serial_error) {
+            return false;
+        }
+        offset += r;
+        return true;
+    }
+};
+
+// Tuple case.
+template<class... Ts>
+struct serial<std::tuple<Ts...>> : serial_tuple<std::tuple<Ts...>> {};
+
+// String case.
+template<class Char, class Traits, class Alloc>
+struct serial<std::basic_string<Char, Traits, Alloc>, std::enable_if_t<
+    std::is_trivially_copyable<Char>::value
+>> {
+    using string_t = std::basic_string<Char, Traits, Alloc>;
+
+    static constexpr bool fixed = false;
+    static constexpr bool flat = false;
+    static constexpr std::size_t min_size = sizeof(std::uint64_t);
+
+    static std::size_t size(const string_t& x) noexcept {
+        return min_size + x.size() * sizeof(Char);
+    }
+
+    static std::size_t write(std::byte* out, const string_t& x) noexcept {
+        const std::size_t offset = serial_write_count(out, x.size());
+        if (!x.empty()) {
+            std::memcpy(out + offset, x.data(), x.size() * sizeof(Char));
+        }
+        return offset + x.size() * sizeof(Char);
+    }
+
+    static std::size_t read(const std::byte* in, std::size_t n, string_t& x) {
+        std::size_t count = 0;
+        const std::size_t offset = serial_read_count(in, n, sizeof(Char), count);
+        if (offset == serial_error) {
+            return serial_error;
+        }
+        x.resize(count);
+        if (count != 0) {
+            std::memcpy(x.data(), in + offset, count * sizeof(Char));
+        }
+        return offset + count * sizeof(Char);
+    }
+};
+
+// Vector case.
+template<class T, class Alloc>
+struct serial<std::vector<T, Alloc>, std::enable_if_t<
+    is_serializable<T>::value && !std::is_same_v<T, bool>
+>> {
+    using vector_t = std::vector<T, Alloc>;
+
+    static constexpr bool fixed = false;
+    static constexpr bool flat = false;
+    static constexpr std::size_t min_size = sizeof(std::uint64_t);
+
+    static std::size_t size(const vector_t& x) noexcept {
+        if constexpr (serial<T>::fixed) {
+            return min_size + x.size() * serial<T>::min_size;
+        } else {
+            std::size_t result = min_size;
+            for (const auto& y : x) {
+                result += serial<T>::size(y);
+            }
+            return result;
+        }
+    }
+
+    static std::size_t write(std::byte* out, const vector_t& x) noexcept {
+        std::size_t offset = serial_write_count(out, x.size());
+        if constexpr (serial<T>::flat && !is_serial_tuple<T>::value) {
+            // An empty vector may have a null data(), which memcpy does not accept.
+            if (!x.empty()) {
+                std::memcpy(out + offset, x.data(), x.size() * sizeof(T));
+                offset += x.size() * sizeof(T);
+            }
+        } else {
+            for (const auto& y : x) {
+                offset += serial<T>::write(out + offset, y);
+            }
+        }
+        return offset;
+    }
+
+    static std::size_t read(const std::byte* in, std::size_t n, vector_t& x) {
+        std::size_t count = 0;
+        std::size_t offset = serial_read_count(in, n, serial<T>::min_size, count);
+        if (offset == serial_error) {
+            return serial_error;
+        }
+
+        x.resize(count);
+        if constexpr (serial<T>::flat && !is_serial_tuple<T>::value) {
+            if (count != 0) {
+                std::memcpy(x.data(), in + offset, count * sizeof(T));
+                offset += count * sizeof(T);
+            }
+        } else {
+            for (auto& y : x) {
+                const std::size_t r = serial<T>::read(in + offset, n - offset, y);
+                if (r == serial_error) {
+                    return serial_error;
+                }
+                offset += r;
+            }
+        }
+        return offset;
+    }
+};
+
+// Offsets of the elements of a flat tuple in its serialized form.
+template<class Tuple, std::size_t... Ns>
+static constexpr auto serial_offsets(std::index_sequence<Ns...>) noexcept {
+    constexpr std::size_t sizes[] = {sizeof(serial_element_t<Ns, Tuple>)..., 0};
+
+    std::array<std::size_t, sizeof...(Ns) + 1> offsets{};
+    for (std::size_t i = 0; i < sizeof...(Ns); ++i) {
+        offsets[i + 1] = offsets[i] + sizes[i];
+    }
+    return offsets;
+}
+
+// Dispatch case.
+template<class Tuple, class Seq = std::make_index_sequence<std::tuple_size_v<Tuple>>, class = void>
+struct serial_layout {
+    static constexpr bool viewable = false;
+};
+
+// Variadic case.
+template<class Tuple, std::size_t... Ns>
+struct serial_layout<Tuple, std::index_sequence<Ns...>, std::enable_if_t<
+    serial_tuple<Tuple>::flat
+>> {
+    static constexpr auto offsets = serial_offsets<Tuple>(std::index_sequence<Ns...>{});
+    static constexpr std::size_t alignment = std::max({
+        std::size_t{1},
+        alignof(serial_element_t<Ns, Tuple>)...
+    });
+    static constexpr bool viewable = (
+        true && ... && (offsets[Ns] % alignof(serial_element_t<Ns, Tuple>) == 0)
+    );
+};
+
+} // namespace detail
+
+/** Get the serialized size of a fixed-size tuple type as a std::integral_constant.
+ *
+ * Only defined when all elements are trivially copyable, so that buffers can be pre-sized at
+ * compile-time.
+ *
+ * @tparam  Tuple   Tuple type.
+ */
+template<class Tuple, class = void>
+struct serialized_size {};
+
+template<class Tuple>
+struct serialized_size<Tuple, std::enable_if_t<detail::serial_tuple<std::decay_t<Tuple>>::fixed>>
+: std::integral_constant<std::size_t, detail::serial_tuple<std::decay_t<Tuple>>::min_size> {};
+
+/** Get the serialized size of a fixed-size tuple type.
+ *
+ * See serialized_size for more details.
+ *
+ * @tparam  Tuple   Tuple type.
+ */
+template<class Tuple>
+static constexpr std::size_t serialized_size_v = serialized_size<Tuple>::value;
+
+/** Get the serialized size of a tuple.
+ *
+ * @tparam  Tuple   Tuple type.
+ *
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Number of bytes written by serialize.
+ */
+template<class Tuple>
+std::size_t serialized_size_of(const Tuple& tuple) noexcept {
+    return detail::serial_tuple<std::decay_t<Tuple>>::size(tuple);
+}
+
+/** Functor for serializing a std::tuple into a buffer.
+ *
+ * Flat tuples are written by copying the packed object representations at constant offsets, all
+ * other tuples are written field-wise. See fxx/tuple/serialize.h for the format.
+ */
+struct serialize_f {
+    template<class Tuple>
+    std::optional<std::size_t> operator()(const Tuple& tuple, std::span<std::byte> buffer) const
+    noexcept {
+        using serial_t = detail::serial_tuple<std::decay_t<Tuple>>;
+
+        if (serial_t::size(tuple) > buffer.size()) {
+            return std::nullopt;
+        }
+        return serial_t::write(buffer.data(), tuple);
+    }
+};
+
+/** Serialize a std::tuple into a buffer.
+ *
+ * See serialize_f for more details.
+ *
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    tuple   Input tuple.
+ * @param   [out]   buffer  Output buffer.
+ *
+ * @return  Number of bytes written, or std::nullopt if the buffer is too small.
+ */
+template<class Tuple>
+std::optional<std::size_t> serialize(const Tuple& tuple, std::span<std::byte> buffer) noexcept {
+    return serialize_f{}(tuple, buffer);
+}
+
+/** Functor for deserializing a std::tuple from a buffer.
+ *
+ * The elements are default-constructed, and then read in order. Element counts are validated
+ * against the buffer size before anything is allocated.
+ *
+ * @tparam  Tuple   Result tuple type.
+ */
+template<class Tuple>
+struct deserialize_f {
+    static_assert(
+        std::is_default_constructible<Tuple>::value,
+        "Deserialized tuples must be default-constructible!"
+    );
+
+    std::optional<Tuple> operator()(std::span<const std::byte> buffer) const {
+        Tuple result{};
+        const std::size_t r = detail::serial_tuple<Tuple>::read(
+            buffer.data(),
+            buffer.size(),
+            result
+        );
+        if (r == detail::serial_error) {
+            return std::nullopt;
+        }
+        return result;
+    }
+};
+
+/** Deserialize a std::tuple from a buffer.
+ *
+ * See deserialize_f for more details.
+ *
+ * @tparam  Tuple   Result tuple type.
+ *
+ * @param   [in]    buffer  Input buffer.
+ *
+ * @return  The tuple, or std::nullopt if the buffer is truncated or malformed.
+ */
+template<class Tuple>
+std::optional<Tuple> deserialize(std::span<const std::byte> buffer) {
+    return deserialize_f<Tuple>{}(buffer);
+}
+
+/** Functor for serializing a contiguous range of std::tuples into a buffer.
+ *
+ * The tuples are written back to back. For fixed-size tuples, the buffer size is checked once and
+ * every tuple is written at a constant stride.
+ */
+struct serialize_range_f {
+    template<class Range>
+    std::optional<std::size_t> operator()(const Range& tuples, std::span<std::byte> buffer) const
+    noexcept {
+        using tuple_t = std::decay_t<decltype(*std::data(tuples))>;
+        using serial_t = detail::serial_tuple<tuple_t>;
+
+        const tuple_t* const first = std::data(tuples);
+        const std::size_t count = std::size(tuples);
+
+        if constexpr (serial_t::fixed) {
+            if (count > buffer.size() / std::max<std::size_t>(serial_t::min_size, 1)) {
+                return std::nullopt;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                serial_t::write(buffer.data() + i * serial_t::min_size, first[i]);
+            }
+            return count * serial_t::min_size;
+        } else {
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                size += serial_t::size(first[i]);
+            }
+            if (size > buffer.size()) {
+                return std::nullopt;
+            }
+
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                offset += serial_t::write(buffer.data() + offset, first[i]);
+            }
+            return offset;
+        }
+    }
+};
+
+/** Serialize a contiguous range of std::tuples into a buffer.
+ *
+ * See serialize_range_f for more details.
+ *
+ * @tparam  Range   Input range type (e.g. std::vector, std::array or std::span of tuples).
+ *
+ * @param   [in]    tuples  Input tuples.
+ * @param   [out]   buffer  Output buffer.
+ *
+ * @return  Number of bytes written, or std::nullopt if the buffer is too small.
+ */
+template<class Range>
+std::optional<std::size_t> serialize_range(const Range& tuples, std::span<std::byte> buffer)
+noexcept {
+    return serialize_range_f{}(tuples, buffer);
+}
+
+/** Functor for deserializing a contiguous range of std::tuples from a buffer.
+ *
+ * Reads one tuple for every element of the output range, which must already have the expected
+ * size.
+ */
+struct deserialize_range_f {
+    template<class Range>
+    std::optional<std::size_t> operator()(std::span<const std::byte> buffer, Range&& tuples)
+    const {
+        using tuple_t = std::decay_t<decltype(*std::data(tuples))>;
+        using serial_t = detail::serial_tuple<tuple_t>;
+
+        tuple_t* const first = std::data(tuples);
+        const std::size_t count = std::size(tuples);
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t r = serial_t::read(
+                buffer.data() + offset,
+                buffer.size() - offset,
+                first[i]
+            );
+            if (r == detail::serial_error) {
+                return std::nullopt;
+            }
+            offset += r;
+        }
+        return offset;
+    }
+};
+
+/** Deserialize a contiguous range of std::tuples from a buffer.
+ *
+ * See deserialize_range_f for more details.
+ *
+ * @tparam  Range   Output range type (e.g. std::vector, std::array or std::span of tuples).
+ *
+ * @param   [in]    buffer  Input buffer.
+ * @param   [out]   tuples  Output tuples.
+ *
+ * @return  Number of bytes read, or std::nullopt if the buffer is truncated or malformed.
+ */
+template<class Range>
+std::optional<std::size_t> deserialize_range(std::span<const std::byte> buffer, Range&& tuples) {
+    return deserialize_range_f{}(buffer, std::forward<Range>(tuples));
+}
+
+namespace views {
+
+/** Tuple-like view of a serialized flat tuple, which refers to the elements inside the buffer.
+ *
+ * Element I of the view is a const reference to element I of the serialized tuple. The view
+ * supports `tuple_size`, `tuple_element`, ADL-found `get` and structured bindings.
+ *
+ * Views are obtained through view_serialized_f, which checks that the buffer can be viewed.
+ *
+ * @warning The view refers to the buffer, which must outlive it.
+ * @warning Accessing the elements in place relies on the buffer holding implicitly created objects
+ *          of the trivially copyable element types, as it does when it was filled by `memcpy` or
+ *          by an I/O call (C++20 P0593).
+ *
+ * @tparam  Tuple   Serialized tuple type.
+ */
+template<class Tuple>
+class serialized_view {
+    using layout_t = detail::serial_layout<Tuple>;
+
+public:
+    /** Get the offset of element @p I in the buffer. */
+    template<std::size_t I>
+    static constexpr std::size_t offset_at = layout_t::offsets[I];
+
+    explicit serialized_view(const std::byte* data) noexcept : m_data{data} {}
+
+    /** Get the underlying buffer. */
+    const std::byte* data() const noexcept { return m_data; }
+
+    /** Get element @p I. */
+    template<std::size_t I>
+    const detail::serial_element_t<I, Tuple>& get() const noexcept {
+        return *std::launder(
+            reinterpret_cast<const detail::serial_element_t<I, Tuple>*>(m_data + offset_at<I>)
+        );
+    }
+
+private:
+    const std::byte* m_data;
+};
+
+/** Get an element of a serialized view.
+ *
+ * @tparam  I       Element index.
+ *
+ * @param   [in]    view    Input view.
+ *
+ * @return  Reference to the element in the buffer.
+ */
+template<std::size_t I, class Tuple>
+const detail::serial_element_t<I, Tuple>& get(const serialized_view<Tuple>& view) noexcept {
+    return view.template get<I>();
+}
+
+} // namespace views
+
+/** Functor for viewing a serialized std::tuple without copying it.
+ *
+ * Viewing is possible when the tuple is flat, every element offset is a multiple of its
+ * alignment, and the buffer is aligned to the largest element alignment. Use deserialize_f
+ * otherwise.
+ *
+ * @tparam  Tuple   Serialized tuple type.
+ */
+template<class Tuple>
+struct view_serialized_f {
+    std::optional<views::serialized_view<Tuple>> operator()(std::span<const std::byte> buffer) const
+    noexcept {
+        using layout_t = detail::serial_layout<Tuple>;
+
+        if constexpr (layout_t::viewable) {
+            const auto address = reinterpret_cast<std::uintptr_t>(buffer.data());
+            if (buffer.size() < serialized_size_v<Tuple> || address % layout_t::alignment != 0) {
+                return std::nullopt;
+            }
+            return views::serialized_view<Tuple>(buffer.data());
+        } else {
+            return std::nullopt;
+        }
+    }
+};
+
+/** View a serialized std::tuple without copying it.
+ *
+ * See view_serialized_f for more details.
+ *
+ * @tparam  Tuple   Serialized tuple type.
+ *
+ * @param   [in]    buffer  Input buffer.
+ *
+ * @return  The view, or std::nullopt if the tuple can not be viewed in place.
+ */
+template<class Tuple>
+std::optional<views::serialized_view<Tuple>> view_serialized(std::span<const std::byte> buffer)
+noexcept {
+    return view_serialized_f<Tuple>{}(buffer);
+}
+
+} } // namespace fxx::tuple
+
+namespace std {
+
+template<class Tuple>
+struct tuple_size<fxx::tuple::views::serialized_view<Tuple>>
+: std::integral_constant<std::size_t, std::tuple_size_v<Tuple>> {};
+
+template<std::size_t I, class Tuple>
+struct tuple_element<I, fxx::tuple::views::serialized_view<Tuple>> {
+    using type = const fxx::tuple::detail::serial_element_t<I, Tuple>;
+};
+
+} // namespace std
+
+#endif
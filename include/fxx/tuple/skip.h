@@ -19,6 +19,16 @@
 #include <fxx/tuple/pick.h>
 // fxx::tuple::pick_f
 
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::decay_t
+#include <utility>
+// std::forward
+
+#include <cstddef>
+// std::size_t
+
 namespace fxx { namespace tuple {
 
 /** Functor for skipping std::tuple elements.
@@ -30,10 +40,15 @@ namespace fxx { namespace tuple {
 template<std::size_t N>
 struct skip_f {
     template<class Tuple>
-    constexpr auto operator()(Tuple&& tuple) noexcept {
-        using idx_range_t = fxx::meta::make_index_range<N, std::tuple_size_v<Tuple> - N>;
-        using pick_f_t = fxx::meta::apply_index_sequence_t<pick_f, idx_range_t>;
-        return pick_f_t{}(std::forward<Tuple>(tuple));
+    using pick_f_t = fxx::meta::apply_index_sequence_t<
+        pick_f,
+        fxx::meta::make_index_range<N, std::tuple_size_v<std::decay_t<Tuple>> - N>
+    >;
+
+    template<class Tuple>
+    constexpr auto operator()(Tuple&& tuple)
+    noexcept(noexcept(pick_f_t<Tuple>{}(std::forward<Tuple>(tuple)))) {
+        return pick_f_t<Tuple>{}(std::forward<Tuple>(tuple));
     }
 };
 
@@ -49,7 +64,7 @@ struct skip_f {
  * @return  Result tuple.
  */
 template<std::size_t N, class Tuple>
-constexpr auto skip(Tuple&& tuple) noexcept {
+constexpr auto skip(Tuple&& tuple) noexcept(noexcept(skip_f<N>{}(std::forward<Tuple>(tuple)))) {
     return skip_f<N>{}(std::forward<Tuple>(tuple));
 }
 
@@ -19,6 +19,12 @@
 #include <fxx/tuple/pick.h>
 // fxx::tuple::pick_f
 
+#include <utility>
+// std::forward
+
+#include <cstddef>
+// std::size_t
+
 namespace fxx { namespace tuple {
 
 /** Functor for std::tuple slicing.
@@ -30,10 +36,14 @@ namespace fxx { namespace tuple {
  */
 template<std::size_t Start, std::size_t Length>
 struct slice_f {
+    using pick_f_t = fxx::meta::apply_index_sequence_t<
+        pick_f,
+        fxx::meta::make_index_range<Start, Length>
+    >;
+
     template<class Tuple>
-    constexpr auto operator()(Tuple&& tuple) noexcept {
-        using idx_range_t = fxx::meta::make_index_range<Start, Length>;
-        using pick_f_t = fxx::meta::apply_index_sequence_t<pick_f, idx_range_t>;
+    constexpr auto operator()(Tuple&& tuple)
+    noexcept(noexcept(pick_f_t{}(std::forward<Tuple>(tuple)))) {
         return pick_f_t{}(std::forward<Tuple>(tuple));
     }
 };
@@ -51,7 +61,8 @@ struct slice_f {
  * @return  Result tuple.
  */
 template<std::size_t Start, std::size_t Length, class Tuple>
-constexpr auto slice(Tuple&& tuple) noexcept {
+constexpr auto slice(Tuple&& tuple)
+noexcept(noexcept(slice_f<Start, Length>{}(std::forward<Tuple>(tuple)))) {
     return slice_f<Start, Length>{}(std::forward<Tuple>(tuple));
 }
 
@@ -13,10 +13,8 @@
 #define FXX_TUPLE_TAKE_H
 #pragma once
 
-#include <tuple>
-// std::(tuple, tuple_cat)
 #include <utility>
-// std::make_index_sequence
+// std::(forward, make_index_sequence)
 
 #include <cstddef>
 // std::size_t
@@ -37,10 +35,11 @@ namespace fxx { namespace tuple {
  */
 template<std::size_t N>
 struct take_f {
+    using pick_f_t = fxx::meta::apply_index_sequence_t<pick_f, std::make_index_sequence<N>>;
+
     template<class Tuple>
-    constexpr auto operator()(Tuple&& tuple) noexcept {
-        using idx_seq_t = std::make_index_sequence<N>;
-        using pick_f_t = fxx::meta::apply_index_sequence_t<pick_f, idx_seq_t>;
+    constexpr auto operator()(Tuple&& tuple)
+    noexcept(noexcept(pick_f_t{}(std::forward<Tuple>(tuple)))) {
         return pick_f_t{}(std::forward<Tuple>(tuple));
     }
 };
@@ -57,7 +56,7 @@ struct take_f {
  * @return  Result tuple.
  */
 template<std::size_t N, class Tuple>
-constexpr auto take(Tuple&& tuple) noexcept {
+constexpr auto take(Tuple&& tuple) noexcept(noexcept(take_f<N>{}(std::forward<Tuple>(tuple)))) {
     return take_f<N>{}(std::forward<Tuple>(tuple));
 }
 
@@ -0,0 +1,182 @@
+/** Implements transposition between ranges of std::tuples and std::tuples of ranges.
+ *
+ * @file        tuple/transpose.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_TRANSPOSE_H
+#define FXX_TUPLE_TRANSPOSE_H
+#pragma once
+
+#include <fxx/meta/tuple.h>
+// fxx::meta::tuple_map_t
+
+#include <algorithm>
+// std::min
+#include <iterator>
+// std::(begin, distance, end, forward_iterator_tag, iterator_traits, make_move_iterator)
+#include <tuple>
+// std::(get, make_tuple, tuple, tuple_size_v)
+#include <type_traits>
+// std::(decay_t, false_type, is_base_of_v, is_lvalue_reference_v, true_type)
+#include <utility>
+// std::(declval, forward, index_sequence, make_index_sequence, move)
+#include <vector>
+// std::vector
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+template<class T>
+using transpose_column_t = std::vector<T>;
+
+template<class Range>
+using transpose_value_t = std::decay_t<decltype(*std::begin(std::declval<Range&>()))>;
+
+// Indicates whether a range can be traversed more than once.
+template<class Range>
+static constexpr bool is_forward_range_v = std::is_base_of_v<
+    std::forward_iterator_tag,
+    typename std::iterator_traits<
+        decltype(std::begin(std::declval<Range&>()))
+    >::iterator_category
+>;
+
+// Dispatch case.
+template<class>
+struct is_std_tuple : std::false_type {};
+
+// Variadic case.
+template<class... Ts>
+struct is_std_tuple<std::tuple<Ts...>> : std::true_type {};
+
+// Type of a column as obtained from std::get on a (forwarded) tuple of columns.
+template<std::size_t I, class Columns>
+using transpose_get_t = decltype(std::get<I>(std::declval<Columns>()));
+
+// Get an iterator that copies from lvalue and moves from rvalue ranges.
+template<class Range, class Iterator>
+static constexpr auto transpose_iterator(Iterator it) {
+    if constexpr (std::is_lvalue_reference_v<Range>) {
+        return it;
+    } else {
+        return std::make_move_iterator(it);
+    }
+}
+
+// Fill a single column sequentially from a range of rows.
+template<std::size_t I, class Range, class Column>
+static void transpose_column(Range&& rows, Column& column, std::size_t size) {
+    column.reserve(size);
+    for (auto it = std::begin(rows); it != std::end(rows); ++it) {
+        if constexpr (std::is_lvalue_reference_v<Range>) {
+            column.push_back(std::get<I>(*it));
+        } else {
+            column.push_back(std::get<I>(std::move(*it)));
+        }
+    }
+}
+
+template<class Range, std::size_t... Ns>
+static auto transpose_rows(Range&& rows, std::index_sequence<Ns...>) {
+    using row_t = transpose_value_t<Range>;
+    using result_t = fxx::meta::tuple_map_t<transpose_column_t, row_t>;
+    static_assert(
+        is_forward_range_v<Range>,
+        "Rows are counted and then traversed once per column, which requires a forward range."
+    );
+
+    const auto size = static_cast<std::size_t>(std::distance(std::begin(rows), std::end(rows)));
+
+    result_t result;
+    (transpose_column<Ns>(std::forward<Range>(rows), std::get<Ns>(result), size), ...);
+    return result;
+}
+
+template<class Columns, std::size_t... Ns>
+static auto transpose_columns(Columns&& columns, std::index_sequence<Ns...>) {
+    using row_t = fxx::meta::tuple_map_t<transpose_value_t, std::decay_t<Columns>>;
+    using result_t = std::vector<row_t>;
+    static_assert(
+        (is_forward_range_v<transpose_get_t<Ns, Columns>> && ...),
+        "Columns are counted before they are traversed, which requires forward ranges."
+    );
+
+    result_t result;
+    if constexpr (sizeof...(Ns) > 0) {
+        const auto size = std::min({static_cast<std::size_t>(std::distance(
+            std::begin(std::get<Ns>(columns)),
+            std::end(std::get<Ns>(columns))
+        ))...});
+        result.reserve(size);
+
+        // Columns that are held by reference (e.g. std::tie) are copied, even from an rvalue.
+        auto its = std::make_tuple(
+            transpose_iterator<transpose_get_t<Ns, Columns>>(std::begin(std::get<Ns>(columns)))...
+        );
+        for (std::size_t i = 0; i < size; ++i) {
+            result.emplace_back(*std::get<Ns>(its)...);
+            (++std::get<Ns>(its), ...);
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+/** Functor for transposing between ranges of std::tuples and std::tuples of ranges.
+ *
+ * A range of `std::tuple<Ts...>` rows is transposed into a `std::tuple<std::vector<Ts>...>` of
+ * columns. Every column is allocated once, at its final size, and then written sequentially.
+ *
+ * A std::tuple of column ranges is transposed into a `std::vector` of rows. If the columns differ
+ * in size, the result has as many rows as the shortest column.
+ *
+ * Elements are copied from lvalue inputs and moved from rvalue inputs.
+ *
+ * @note    The rows (or every column) must form a forward range, because they are counted before
+ *          they are traversed, and rows are traversed once per column.
+ */
+struct transpose_f {
+    template<class Input>
+    auto operator()(Input&& input) {
+        if constexpr (detail::is_std_tuple<std::decay_t<Input>>::value) {
+            return detail::transpose_columns(
+                std::forward<Input>(input),
+                std::make_index_sequence<std::tuple_size_v<std::decay_t<Input>>>{}
+            );
+        } else {
+            using row_t = detail::transpose_value_t<Input>;
+            return detail::transpose_rows(
+                std::forward<Input>(input),
+                std::make_index_sequence<std::tuple_size_v<row_t>>{}
+            );
+        }
+    }
+};
+
+/** Transpose between a range of std::tuples and a std::tuple of ranges.
+ *
+ * @tparam  Input   Input type (a range of std::tuples, or a std::tuple of ranges).
+ *
+ * @param   [in]    input   Input rows or columns.
+ *
+ * @return  Columns as a std::tuple of std::vectors, or rows as a std::vector of std::tuples.
+ */
+template<class Input>
+auto transpose(Input&& input) {
+    return transpose_f{}(std::forward<Input>(input));
+}
+
+} } // namespace fxx::tuple
+
+#endif
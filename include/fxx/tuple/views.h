@@ -0,0 +1,244 @@
+/** Implements non-owning, index-remapping views over std::tuples.
+ *
+ * The views in this file mirror fxx::tuple::(pick, slice, flip, skip, take), but instead of
+ * constructing a new std::tuple they refer to the source tuple through a compile-time index
+ * sequence. Applying a view to a view combines both index sequences, so that chains of views never
+ * copy elements until the result is explicitly materialized.
+ *
+ * @file        tuple/views.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_VIEWS_H
+#define FXX_TUPLE_VIEWS_H
+#pragma once
+
+#include <fxx/meta/indices.h>
+// fxx::meta::(apply_index_sequence_t, make_index_range)
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+
+#include <array>
+// std::array
+#include <tuple>
+// std::(tuple, tuple_element, tuple_element_t, tuple_size, tuple_size_v)
+#include <type_traits>
+// std::(integral_constant, remove_const_t, remove_reference_t)
+#include <utility>
+// std::(forward, index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+/** Non-owning tuple views namespace. */
+namespace views {
+
+/** Tuple-like view that remaps indices into a source tuple.
+ *
+ * Element I of the view is element `Ns[I]` of the source. The view supports `tuple_size`,
+ * `tuple_element`, ADL-found `get` and structured bindings.
+ *
+ * @warning The view refers to the source, which must outlive it.
+ *
+ * @tparam  Tuple   Source tuple type (possibly const).
+ * @tparam  Ns      Source indices.
+ */
+template<class Tuple, std::size_t... Ns>
+class index_view {
+public:
+    using source_type = Tuple;
+    using indices = std::index_sequence<Ns...>;
+
+    /** Get the source index of element @p I. */
+    template<std::size_t I>
+    static constexpr std::size_t index_at = std::array<std::size_t, sizeof...(Ns)>{Ns...}[I];
+
+    constexpr explicit index_view(Tuple& source) noexcept : m_source{&source} {}
+
+    /** Get the source tuple. */
+    constexpr Tuple& source() const noexcept { return *m_source; }
+
+    /** Get element @p I. */
+    template<std::size_t I>
+    constexpr decltype(auto) get() const noexcept {
+        return fxx::tuple::detail::element<index_at<I>>(*m_source);
+    }
+
+private:
+    Tuple* m_source;
+};
+
+/** Get an element of an index view.
+ *
+ * @tparam  I       Element index.
+ *
+ * @param   [in]    view    Input view.
+ *
+ * @return  Reference to the source element.
+ */
+template<std::size_t I, class Tuple, std::size_t... Ns>
+constexpr decltype(auto) get(const index_view<Tuple, Ns...>& view) noexcept {
+    return view.template get<I>();
+}
+
+/** Functor for picking view elements.
+ *
+ * Accepts lvalue tuples and (possibly temporary) views. Temporary tuples are rejected, because a
+ * view of them would dangle.
+ *
+ * @tparam  Ks  Indices to pick.
+ */
+template<std::size_t... Ks>
+struct pick_f {
+    template<class Tuple>
+    constexpr auto operator()(Tuple& tuple) const noexcept {
+        return index_view<Tuple, Ks...>(tuple);
+    }
+
+    // Combine the index sequences instead of nesting the views.
+    template<class Tuple, std::size_t... Ns>
+    constexpr auto operator()(const index_view<Tuple, Ns...>& view) const noexcept {
+        return index_view<Tuple, index_view<Tuple, Ns...>::template index_at<Ks>...>(
+            view.source()
+        );
+    }
+
+    template<class Tuple, std::size_t... Ns>
+    constexpr auto operator()(index_view<Tuple, Ns...>& view) const noexcept {
+        return (*this)(static_cast<const index_view<Tuple, Ns...>&>(view));
+    }
+};
+
+namespace detail {
+
+template<class Tuple>
+static constexpr std::size_t size_v = std::tuple_size_v<std::remove_reference_t<Tuple>>;
+
+template<std::size_t N, std::size_t... Ns>
+static constexpr auto flip_pick(std::index_sequence<Ns...>) noexcept {
+    return pick_f<(N - 1 - Ns)...>{};
+}
+
+} // namespace detail
+
+/** Functor for viewing a sub-range of a tuple.
+ *
+ * @tparam  Start   Start index.
+ * @tparam  Length  Number of elements.
+ */
+template<std::size_t Start, std::size_t Length>
+struct slice_f {
+    template<class Tuple>
+    constexpr auto operator()(Tuple&& tuple) const noexcept {
+        using pick_t = fxx::meta::apply_index_sequence_t<
+            pick_f,
+            fxx::meta::make_index_range<Start, Length>
+        >;
+        return pick_t{}(std::forward<Tuple>(tuple));
+    }
+};
+
+/** Functor for viewing the first @p N elements of a tuple. */
+template<std::size_t N>
+struct take_f {
+    template<class Tuple>
+    constexpr auto operator()(Tuple&& tuple) const noexcept {
+        return slice_f<0, N>{}(std::forward<Tuple>(tuple));
+    }
+};
+
+/** Functor for viewing all but the first @p N elements of a tuple. */
+template<std::size_t N>
+struct skip_f {
+    template<class Tuple>
+    constexpr auto operator()(Tuple&& tuple) const noexcept {
+        return slice_f<N, detail::size_v<Tuple> - N>{}(std::forward<Tuple>(tuple));
+    }
+};
+
+/** Functor for viewing a tuple in reverse order. */
+struct flip_f {
+    template<class Tuple>
+    constexpr auto operator()(Tuple&& tuple) const noexcept {
+        using seq_t = std::make_index_sequence<detail::size_v<Tuple>>;
+        return detail::flip_pick<detail::size_v<Tuple>>(seq_t{})(std::forward<Tuple>(tuple));
+    }
+};
+
+/** View elements of a tuple (or view) at a list of indices. */
+template<std::size_t... Ks, class Tuple>
+constexpr auto pick(Tuple&& tuple) noexcept {
+    return pick_f<Ks...>{}(std::forward<Tuple>(tuple));
+}
+
+/** View a sub-range of a tuple (or view). */
+template<std::size_t Start, std::size_t Length, class Tuple>
+constexpr auto slice(Tuple&& tuple) noexcept {
+    return slice_f<Start, Length>{}(std::forward<Tuple>(tuple));
+}
+
+/** View the first @p N elements of a tuple (or view). */
+template<std::size_t N, class Tuple>
+constexpr auto take(Tuple&& tuple) noexcept {
+    return take_f<N>{}(std::forward<Tuple>(tuple));
+}
+
+/** View all but the first @p N elements of a tuple (or view). */
+template<std::size_t N, class Tuple>
+constexpr auto skip(Tuple&& tuple) noexcept {
+    return skip_f<N>{}(std::forward<Tuple>(tuple));
+}
+
+/** View a tuple (or view) in reverse order. */
+template<class Tuple>
+constexpr auto flip(Tuple&& tuple) noexcept {
+    return flip_f{}(std::forward<Tuple>(tuple));
+}
+
+/** Get a std::tuple of references to the elements of a view.
+ *
+ * The result can be passed to the functors in fxx::tuple without copying elements.
+ */
+template<class Tuple, std::size_t... Ns>
+constexpr auto tie(const index_view<Tuple, Ns...>& view) noexcept {
+    return std::tuple<decltype(fxx::tuple::detail::element<Ns>(view.source()))...>(
+        fxx::tuple::detail::element<Ns>(view.source())...
+    );
+}
+
+/** Materialize a view into a std::tuple of copies of its elements. */
+template<class Tuple, std::size_t... Ns>
+constexpr auto materialize(const index_view<Tuple, Ns...>& view) {
+    return std::tuple<std::tuple_element_t<Ns, std::remove_const_t<Tuple>>...>(
+        fxx::tuple::detail::element<Ns>(view.source())...
+    );
+}
+
+} // namespace views
+
+} } // namespace fxx::tuple
+
+namespace std {
+
+template<class Tuple, std::size_t... Ns>
+struct tuple_size<fxx::tuple::views::index_view<Tuple, Ns...>>
+: std::integral_constant<std::size_t, sizeof...(Ns)> {};
+
+template<std::size_t I, class Tuple, std::size_t... Ns>
+struct tuple_element<I, fxx::tuple::views::index_view<Tuple, Ns...>> {
+    using type = std::tuple_element_t<
+        fxx::tuple::views::index_view<Tuple, Ns...>::template index_at<I>,
+        Tuple
+    >;
+};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,182 @@
+/** Implements runtime-indexed std::tuple element visitation.
+ *
+ * @file        tuple/visit.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_VISIT_H
+#define FXX_TUPLE_VISIT_H
+#pragma once
+
+#include <fxx/tuple/element.h>
+// fxx::tuple::detail::element
+#include <fxx/tuple/first.h>
+// fxx::tuple::first_f
+
+#include <optional>
+// std::optional
+#include <tuple>
+// std::tuple_size_v
+#include <type_traits>
+// std::(bool_constant, decay_t, is_same_v)
+#include <utility>
+// std::(as_const, declval, forward, index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+template<std::size_t N, class Result, class Fn, class Tuple>
+static constexpr Result visit_one(Fn& fn, Tuple&& tuple) {
+    return fn(detail::element<N>(std::forward<Tuple>(tuple)));
+}
+
+// Jump table with one entry per element.
+template<class Result, class Fn, class Tuple, std::size_t... Ns>
+static constexpr Result (*const visit_table[])(Fn&, Tuple&&) = {
+    &visit_one<Ns, Result, Fn, Tuple>...
+};
+
+template<class Tuple>
+using visit_seq = std::make_index_sequence<std::tuple_size_v<std::decay_t<Tuple>>>;
+
+// Dispatch case.
+template<class Fn, class Tuple, class Seq = visit_seq<Tuple>>
+struct is_nothrow_visit {};
+
+// Variadic case.
+template<class Fn, class Tuple, std::size_t... Ns>
+struct is_nothrow_visit<Fn, Tuple, std::index_sequence<Ns...>> : std::bool_constant<
+    (noexcept(std::declval<Fn&>()(detail::element<Ns>(std::declval<Tuple>()))) && ...)
+> {};
+
+// Indicates whether visiting any element can not throw.
+template<class Fn, class Tuple>
+static constexpr bool is_nothrow_visit_v = is_nothrow_visit<Fn, Tuple>::value;
+
+template<class Fn, class Tuple, std::size_t... Ns>
+static constexpr decltype(auto) visit_at_impl(
+    std::size_t i,
+    Fn& fn,
+    Tuple&& tuple,
+    std::index_sequence<Ns...>
+) noexcept(is_nothrow_visit_v<Fn, Tuple>) {
+    static_assert(sizeof...(Ns) > 0, "0-Tuple has no elements to visit!");
+
+    using result_t = decltype(fn(detail::element<0>(std::forward<Tuple>(tuple))));
+    static_assert(
+        (
+            std::is_same_v<result_t, decltype(fn(detail::element<Ns>(std::forward<Tuple>(tuple))))>
+            && ...
+        ),
+        "Visitor must return the same type for all elements!"
+    );
+
+    return visit_table<result_t, Fn, Tuple, Ns...>[i](fn, std::forward<Tuple>(tuple));
+}
+
+} // namespace detail
+
+/** Functor for visiting a std::tuple element by runtime index.
+ *
+ * Dispatches through a constant table of function pointers, one for each element, so the cost of a
+ * visit does not depend on the index.
+ *
+ * @warning Behavior is undefined when the index is not smaller than the size of the tuple.
+ * @warning The visitor must return the same type for all elements.
+ */
+struct visit_at_f {
+    template<class Fn, class Tuple>
+    constexpr decltype(auto) operator()(std::size_t i, Fn&& fn, Tuple&& tuple)
+    noexcept(detail::is_nothrow_visit_v<Fn, Tuple>) {
+        return detail::visit_at_impl(i, fn, std::forward<Tuple>(tuple), detail::visit_seq<Tuple>{});
+    }
+};
+
+/** Visit a std::tuple element by runtime index.
+ *
+ * See visit_at_f for more details.
+ *
+ * @tparam  Fn      Visitor type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    i       Element index.
+ * @param   [in]    fn      Visitor.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  Result of invoking @p fn on the @p i -th element.
+ */
+template<class Fn, class Tuple>
+constexpr decltype(auto) visit_at(std::size_t i, Fn&& fn, Tuple&& tuple)
+noexcept(detail::is_nothrow_visit_v<Fn, Tuple>) {
+    return visit_at_f{}(i, std::forward<Fn>(fn), std::forward<Tuple>(tuple));
+}
+
+/** Functor for visiting the first std::tuple element that matches a predicate.
+ *
+ * Matches the elements like first_f, and invokes the visitor on the first match. The result of the
+ * visitor is discarded; combine first_f and visit_at_f to obtain it.
+ *
+ * The predicate only sees the elements as const lvalues, and only the visitor receives the element
+ * with the value category of the forwarded tuple.
+ */
+struct first_visit_f {
+    template<class Pred, class Fn, class Tuple>
+    constexpr std::optional<std::size_t> operator()(Pred&& pred, Fn&& fn, Tuple&& tuple) noexcept(
+        noexcept(first_f{}(std::forward<Pred>(pred), std::as_const(tuple)))
+        && detail::is_nothrow_visit_v<Fn, Tuple>
+    ) {
+        if constexpr (std::tuple_size_v<std::decay_t<Tuple>> == 0) {
+            return std::nullopt;
+        } else {
+            // Only the visitor may consume the tuple, so the predicate must not move from it.
+            const std::optional<std::size_t> idx = first_f{}(
+                std::forward<Pred>(pred),
+                std::as_const(tuple)
+            );
+            if (idx) {
+                visit_at_f{}(*idx, fn, std::forward<Tuple>(tuple));
+            }
+
+            return idx;
+        }
+    }
+};
+
+/** Visit the first std::tuple element that matches a predicate.
+ *
+ * See first_visit_f for more details.
+ *
+ * @tparam  Pred    Predicate type.
+ * @tparam  Fn      Visitor type.
+ * @tparam  Tuple   Input tuple type.
+ *
+ * @param   [in]    pred    Predicate.
+ * @param   [in]    fn      Visitor.
+ * @param   [in]    tuple   Input tuple.
+ *
+ * @return  std::optional<std::size_t>
+ */
+template<class Pred, class Fn, class Tuple>
+constexpr std::optional<std::size_t> first_visit(Pred&& pred, Fn&& fn, Tuple&& tuple) noexcept(
+    noexcept(first_f{}(std::forward<Pred>(pred), std::as_const(tuple)))
+    && detail::is_nothrow_visit_v<Fn, Tuple>
+) {
+    return first_visit_f{}(
+        std::forward<Pred>(pred),
+        std::forward<Fn>(fn),
+        std::forward<Tuple>(tuple)
+    );
+}
+
+} } // namespace fxx::tuple
+
+#endif
@@ -0,0 +1,190 @@
+/** Implements joining std::tuples of futures.
+ *
+ * @file        tuple/when_all.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_WHEN_ALL_H
+#define FXX_TUPLE_WHEN_ALL_H
+#pragma once
+
+#include <fxx/meta/tuple.h>
+// fxx::meta::tuple_map_t
+
+#include <chrono>
+// std::chrono::seconds
+#include <future>
+// std::(future, future_status, shared_future)
+#include <tuple>
+// std::(get, tuple_size_v)
+#include <type_traits>
+// std::(conditional_t, decay_t, is_same_v, is_void_v)
+#include <utility>
+// std::(forward, index_sequence, make_index_sequence, move)
+#include <variant>
+// std::monostate
+
+#if __cplusplus > 201703L && __has_include(<coroutine>)
+#include <coroutine>
+// std::coroutine_handle
+#include <thread>
+// std::thread
+#define FXX_TUPLE_WHEN_ALL_CORO
+#endif
+
+#include <cstddef>
+// std::size_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+// Dispatch case.
+template<class>
+struct when_all_value {};
+
+template<class T>
+struct when_all_value<std::future<T>> {
+    using type = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+};
+
+template<class T>
+struct when_all_value<std::shared_future<T>> {
+    using type = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+};
+
+// Result type obtained from a single future, where void is replaced by std::monostate.
+template<class Future>
+using when_all_value_t = typename when_all_value<std::decay_t<Future>>::type;
+
+template<class Future>
+static when_all_value_t<Future> when_all_get(Future& future) {
+    if constexpr (std::is_same_v<when_all_value_t<Future>, std::monostate>) {
+        future.get();
+        return {};
+    } else {
+        return future.get();
+    }
+}
+
+template<class Futures, std::size_t... Ns>
+static bool when_all_ready(Futures& futures, std::index_sequence<Ns...>) {
+    return (
+        (std::get<Ns>(futures).wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        && ...
+    );
+}
+
+template<class Futures, std::size_t... Ns>
+static void when_all_wait(Futures& futures, std::index_sequence<Ns...>) {
+    (std::get<Ns>(futures).wait(), ...);
+}
+
+template<class Futures, std::size_t... Ns>
+static auto when_all_collect(Futures& futures, std::index_sequence<Ns...>) {
+    using result_t = fxx::meta::tuple_map_t<when_all_value_t, std::decay_t<Futures>>;
+
+    // Braced initialization collects in order, so the exception of the lowest index propagates.
+    return result_t{when_all_get(std::get<Ns>(futures))...};
+}
+
+template<class Futures>
+using when_all_seq_t = std::make_index_sequence<std::tuple_size_v<std::decay_t<Futures>>>;
+
+} // namespace detail
+
+/** Functor for joining a std::tuple of futures.
+ *
+ * Waits until all futures are ready, and only then retrieves their results in order. If futures
+ * hold exceptions, the exception of the lowest index is rethrown after all futures are ready.
+ *
+ * std::future and std::shared_future elements are supported. Results of `void` futures are
+ * represented as std::monostate.
+ *
+ * @warning std::future elements are consumed and become invalid.
+ */
+struct when_all_f {
+    template<class Futures>
+    auto operator()(Futures&& futures) {
+        detail::when_all_wait(futures, detail::when_all_seq_t<Futures>{});
+        return detail::when_all_collect(futures, detail::when_all_seq_t<Futures>{});
+    }
+};
+
+/** Join a std::tuple of futures.
+ *
+ * @tparam  Futures     Input tuple type.
+ *
+ * @param   [in]    futures     Input futures.
+ *
+ * @return  std::tuple of results.
+ */
+template<class Futures>
+auto when_all(Futures&& futures) {
+    return when_all_f{}(std::forward<Futures>(futures));
+}
+
+#ifdef FXX_TUPLE_WHEN_ALL_CORO
+
+/** Awaitable that resumes a coroutine once all futures of a std::tuple are ready.
+ *
+ * If the futures are not ready on suspension, a single waiting thread is started, which resumes
+ * the coroutine exactly once after all futures have become ready.
+ *
+ * @warning Every suspension spawns a new, detached std::thread, which blocks until the futures are
+ *          ready and captures `this`. The coroutine is then resumed on that thread, and the
+ *          awaiter must outlive the wait (as it does in the coroutine frame of a `co_await`). This
+ *          costs a thread creation per suspended await, and is not meant for hot paths; ready
+ *          futures complete without suspending.
+ *
+ * @tparam  Futures     Input tuple type.
+ */
+template<class Futures>
+class when_all_awaiter {
+public:
+    explicit when_all_awaiter(Futures futures) : m_futures{std::move(futures)} {}
+
+    bool await_ready() {
+        return detail::when_all_ready(m_futures, detail::when_all_seq_t<Futures>{});
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        std::thread([this, handle]() {
+            detail::when_all_wait(m_futures, detail::when_all_seq_t<Futures>{});
+            handle.resume();
+        }).detach();
+    }
+
+    auto await_resume() {
+        return detail::when_all_collect(m_futures, detail::when_all_seq_t<Futures>{});
+    }
+
+private:
+    Futures m_futures;
+};
+
+/** Join a std::tuple of futures from a coroutine.
+ *
+ * See when_all_awaiter for more details, including the cost of suspending.
+ *
+ * @tparam  Futures     Input tuple type.
+ *
+ * @param   [in]    futures     Input futures.
+ *
+ * @return  Awaitable producing the std::tuple of results.
+ */
+template<class Futures>
+auto co_when_all(Futures&& futures) {
+    return when_all_awaiter<std::decay_t<Futures>>(std::forward<Futures>(futures));
+}
+
+#endif
+
+} } // namespace fxx::tuple
+
+#endif
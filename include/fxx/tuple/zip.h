@@ -0,0 +1,218 @@
+/** Implements lock-step iteration over multiple ranges.
+ *
+ * @file        tuple/zip.h
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef FXX_TUPLE_ZIP_H
+#define FXX_TUPLE_ZIP_H
+#pragma once
+
+#include <algorithm>
+// std::min
+#include <iterator>
+// std::(begin, end, input_iterator_tag, size)
+#include <tuple>
+// std::(get, tuple)
+#include <type_traits>
+// std::(decay_t, is_default_constructible_v, is_same_v)
+#include <utility>
+// std::(declval, forward, index_sequence, index_sequence_for)
+#include <vector>
+// std::vector
+
+#include <cstddef>
+// std::size_t, std::ptrdiff_t
+
+namespace fxx { namespace tuple {
+
+namespace detail {
+
+template<class Range>
+using zip_iterator_t = decltype(std::begin(std::declval<Range&>()));
+
+template<class Range>
+using zip_reference_t = decltype(*std::declval<zip_iterator_t<Range>>());
+
+/** Lock-step view over multiple random-access ranges.
+ *
+ * All ranges are addressed through a single index, so that iterating performs a single bounds
+ * check per row. The view is as long as its shortest range.
+ *
+ * @tparam  Ranges  Range types.
+ */
+template<class... Ranges>
+class zip_view {
+    using begins_t = std::tuple<zip_iterator_t<Ranges>...>;
+    using seq_t = std::index_sequence_for<Ranges...>;
+
+public:
+    using value_type = std::tuple<std::decay_t<zip_reference_t<Ranges>>...>;
+    using reference = std::tuple<zip_reference_t<Ranges>...>;
+    using size_type = std::size_t;
+
+    class iterator {
+    public:
+        using value_type = zip_view::value_type;
+        using reference = zip_view::reference;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+
+        constexpr iterator(const begins_t& begins, std::size_t index)
+        : m_begins{begins}, m_index{index} {}
+
+        constexpr reference operator*() const { return at(m_begins, m_index, seq_t{}); }
+
+        constexpr iterator& operator++() noexcept {
+            ++m_index;
+            return *this;
+        }
+        constexpr iterator operator++(int) noexcept {
+            auto copy = *this;
+            ++m_index;
+            return copy;
+        }
+
+        constexpr bool operator==(const iterator& other) const noexcept {
+            return m_index == other.m_index;
+        }
+        constexpr bool operator!=(const iterator& other) const noexcept {
+            return m_index != other.m_index;
+        }
+
+    private:
+        begins_t m_begins;
+        std::size_t m_index;
+    };
+
+    constexpr explicit zip_view(Ranges&... ranges)
+    : m_begins{std::begin(ranges)...}, m_size{std::min({std::size_t(std::size(ranges))...})} {}
+
+    /** Get the number of rows. */
+    constexpr std::size_t size() const noexcept { return m_size; }
+    /** Determine whether there are no rows. */
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    constexpr iterator begin() const { return {m_begins, 0}; }
+    constexpr iterator end() const { return {m_begins, m_size}; }
+
+    /** Get a tuple of references to the elements of a row. */
+    constexpr reference operator[](std::size_t i) const { return at(m_begins, i, seq_t{}); }
+
+private:
+    template<std::size_t... Ns>
+    static constexpr reference at(
+        const begins_t& begins,
+        std::size_t i,
+        std::index_sequence<Ns...>
+    ) {
+        return reference(std::get<Ns>(begins)[i]...);
+    }
+
+    begins_t m_begins;
+    std::size_t m_size;
+};
+
+} // namespace detail
+
+/** Functor for zipping ranges.
+ *
+ * The result is a view that yields a std::tuple of references per row, which can be passed to the
+ * other functors in this namespace directly.
+ *
+ * @warning The view refers to the ranges, which must outlive it.
+ */
+struct zip_f {
+    template<class... Ranges>
+    constexpr auto operator()(Ranges&... ranges) {
+        static_assert(sizeof...(Ranges) > 0, "fxx::tuple::zip: At least one range is required.");
+        return detail::zip_view<Ranges...>(ranges...);
+    }
+};
+
+/** Zip ranges for lock-step iteration.
+ *
+ * @tparam  Ranges  Random-access range types.
+ *
+ * @param   [in]    ranges  Input ranges.
+ *
+ * @return  View over std::tuples of element references.
+ */
+template<class... Ranges>
+constexpr auto zip(Ranges&... ranges) {
+    return zip_f{}(ranges...);
+}
+
+/** Functor for transforming zipped ranges.
+ *
+ * The function is invoked with the elements of every row as separate arguments, so that no tuple
+ * is formed in the loop body. Default-constructible results are assigned into a pre-sized vector
+ * through a plain pointer, which keeps the loop vectorizable. Other results, and `bool` results
+ * (whose std::vector has no data()), are constructed in place into a reserved vector instead.
+ */
+struct zip_transform_f {
+    template<class Fn, class... Ranges>
+    auto operator()(Fn&& fn, Ranges&... ranges) {
+        static_assert(
+            sizeof...(Ranges) > 0,
+            "fxx::tuple::zip_transform: At least one range is required."
+        );
+
+        using result_t = std::decay_t<decltype(fn(*std::begin(ranges)...))>;
+
+        const auto size = std::min({std::size_t(std::size(ranges))...});
+        std::vector<result_t> result;
+        if constexpr (
+            std::is_default_constructible_v<result_t>
+            && !std::is_same_v<result_t, bool>
+        ) {
+            // Write through a plain pointer, so that the loop has a single bounds check.
+            result.resize(size);
+            transform(fn, result.data(), size, std::begin(ranges)...);
+        } else {
+            result.reserve(size);
+            transform_back(fn, result, size, std::begin(ranges)...);
+        }
+        return result;
+    }
+
+private:
+    template<class Fn, class Result, class... Iterators>
+    static void transform(Fn& fn, Result* out, std::size_t size, Iterators... its) {
+        for (std::size_t i = 0; i < size; ++i) {
+            out[i] = fn(its[i]...);
+        }
+    }
+
+    template<class Fn, class Result, class... Iterators>
+    static void transform_back(Fn& fn, Result& out, std::size_t size, Iterators... its) {
+        for (std::size_t i = 0; i < size; ++i) {
+            out.emplace_back(fn(its[i]...));
+        }
+    }
+};
+
+/** Transform zipped ranges.
+ *
+ * @tparam  Fn      Transformation function type.
+ * @tparam  Ranges  Random-access range types.
+ *
+ * @param   [in]    fn      Transformation function.
+ * @param   [in]    ranges  Input ranges.
+ *
+ * @return  std::vector of results, as long as the shortest range.
+ */
+template<class Fn, class... Ranges>
+auto zip_transform(Fn&& fn, Ranges&... ranges) {
+    return zip_transform_f{}(std::forward<Fn>(fn), ranges...);
+}
+
+} } // namespace fxx::tuple
+
+#endif
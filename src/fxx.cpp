@@ -1 +1,6 @@
-// This file is empty.
\ No newline at end of file
+#include <fxx/tuple/extern.h>
+
+// Instantiate the cached specializations once for all consumers of the fxx target.
+#ifdef FXX_TUPLE_EXTERN_CACHE
+FXX_TUPLE_CACHE()
+#endif
@@ -0,0 +1,345 @@
+/** C++20 module interface unit of the fxx library.
+ *
+ * Exports the public API of fxx, fxx::meta and fxx::tuple as the `fxx` module. The headers are
+ * included in the global module fragment, so that the module and the headers can be mixed in the
+ * same program.
+ *
+ * The `static constexpr` variable templates (e.g. any_v, tuple_contains_v) have internal linkage
+ * and can not be exported. Use the `::value` of the exported trait instead.
+ *
+ * @file        fxx.cppm
+ * @author      Karl F. A. Friebel (karl.friebel@friebelnet.de)
+ *
+ * @version     0.1
+ * @date        2026-10-14
+ *
+ * @copyright   Copyright (c) 2026
+ */
+
+module;
+
+#include <fxx/meta.h>
+#include <fxx/packed_tuple.h>
+#include <fxx/soa_vector.h>
+#include <fxx/tuple.h>
+
+export module fxx;
+
+export namespace fxx {
+
+using fxx::column_view;
+using fxx::get;
+using fxx::packed_tuple;
+using fxx::soa_vector;
+
+} // namespace fxx
+
+export namespace fxx::meta {
+
+// Functional templates.
+using fxx::meta::identity;
+using fxx::meta::tautology;
+using fxx::meta::contradiction;
+using fxx::meta::constant;
+using fxx::meta::bind;
+using fxx::meta::partial;
+using fxx::meta::any;
+using fxx::meta::all;
+using fxx::meta::none;
+using fxx::meta::count_if;
+
+// Index sequences.
+using fxx::meta::apply_index_sequence_t;
+using fxx::meta::map_index_sequence_t;
+using fxx::meta::shift_index_sequence_t;
+using fxx::meta::scale_index_sequence_t;
+using fxx::meta::make_index_range;
+using fxx::meta::index_buffer;
+using fxx::meta::index_array;
+using fxx::meta::index_sequence_from_t;
+using fxx::meta::index_shift;
+using fxx::meta::index_scale;
+using fxx::meta::index_reverse;
+using fxx::meta::index_rotate;
+using fxx::meta::index_concat;
+using fxx::meta::index_interleave;
+using fxx::meta::index_filter;
+using fxx::meta::reverse_index_sequence_t;
+using fxx::meta::rotate_index_sequence_t;
+using fxx::meta::concat_index_sequence_t;
+using fxx::meta::interleave_index_sequence_t;
+using fxx::meta::filter_index_sequence_t;
+
+// Tuple types.
+using fxx::meta::make_tuple_t;
+using fxx::meta::apply_t;
+using fxx::meta::apply_partial;
+using fxx::meta::first;
+using fxx::meta::find;
+using fxx::meta::tuple_contains;
+using fxx::meta::tuple_index_of;
+using fxx::meta::type_at_t;
+using fxx::meta::types_at_t;
+using fxx::meta::tuple_cat_t;
+using fxx::meta::tuple_flip_t;
+using fxx::meta::tuple_pick_t;
+using fxx::meta::tuple_dup_t;
+using fxx::meta::tuple_skip_t;
+using fxx::meta::tuple_take_t;
+using fxx::meta::tuple_slice_t;
+using fxx::meta::tuple_map_t;
+using fxx::meta::tuple_reduce_t;
+using fxx::meta::tuple_reduce_tree_t;
+using fxx::meta::tuple_fold_t;
+using fxx::meta::tuple_fold_tree_t;
+using fxx::meta::tuple_filter_t;
+using fxx::meta::tuple_filter_seq_t;
+using fxx::meta::tuple_sort_indices_t;
+using fxx::meta::tuple_sort_t;
+using fxx::meta::tuple_unique_seq_t;
+using fxx::meta::tuple_unique_t;
+using fxx::meta::tuple_union_t;
+using fxx::meta::tuple_intersection_t;
+using fxx::meta::tuple_difference_t;
+
+// Detection idiom.
+using fxx::meta::is_detected;
+using fxx::meta::detected_or_t;
+using fxx::meta::detected_t;
+using fxx::meta::is_detected_exact;
+using fxx::meta::is_detected_convertible;
+using fxx::meta::is_detected_nothrow_convertible;
+using fxx::meta::detected;
+using fxx::meta::operator_base;
+using fxx::meta::operator_info;
+
+// Operator traits.
+using fxx::meta::plus_t;
+using fxx::meta::op_plus;
+using fxx::meta::inc_t;
+using fxx::meta::op_inc;
+using fxx::meta::postinc_t;
+using fxx::meta::op_postinc;
+using fxx::meta::minus_t;
+using fxx::meta::op_minus;
+using fxx::meta::dec_t;
+using fxx::meta::op_dec;
+using fxx::meta::postdec_t;
+using fxx::meta::op_postdec;
+using fxx::meta::multiplies_t;
+using fxx::meta::op_multiplies;
+using fxx::meta::divides_t;
+using fxx::meta::op_divides;
+using fxx::meta::modulus_t;
+using fxx::meta::op_modulus;
+using fxx::meta::negate_t;
+using fxx::meta::op_negate;
+using fxx::meta::promote_t;
+using fxx::meta::op_promote;
+using fxx::meta::equal_to_t;
+using fxx::meta::op_equal_to;
+using fxx::meta::not_equal_to_t;
+using fxx::meta::op_not_equal_to;
+using fxx::meta::greater_t;
+using fxx::meta::op_greater;
+using fxx::meta::less_t;
+using fxx::meta::op_less;
+using fxx::meta::greater_equal_t;
+using fxx::meta::op_greater_equal;
+using fxx::meta::less_equal_t;
+using fxx::meta::op_less_equal;
+using fxx::meta::logical_and_t;
+using fxx::meta::op_logical_and;
+using fxx::meta::logical_or_t;
+using fxx::meta::op_logical_or;
+using fxx::meta::logical_not_t;
+using fxx::meta::op_logical_not;
+using fxx::meta::bit_and_t;
+using fxx::meta::op_bit_and;
+using fxx::meta::bit_or_t;
+using fxx::meta::op_bit_or;
+using fxx::meta::bit_xor_t;
+using fxx::meta::op_bit_xor;
+using fxx::meta::bit_not_t;
+using fxx::meta::op_bit_not;
+using fxx::meta::bit_left_shift_t;
+using fxx::meta::op_bit_left_shift;
+using fxx::meta::bit_right_shift_t;
+using fxx::meta::op_bit_right_shift;
+using fxx::meta::deref_t;
+using fxx::meta::op_deref;
+using fxx::meta::addr_of_t;
+using fxx::meta::op_addr_of;
+using fxx::meta::subscript_t;
+using fxx::meta::op_subscript;
+using fxx::meta::call_t;
+using fxx::meta::op_call;
+
+// Operator concepts.
+using fxx::meta::has_op_plus;
+using fxx::meta::has_op_inc;
+using fxx::meta::has_op_postinc;
+using fxx::meta::has_op_minus;
+using fxx::meta::has_op_dec;
+using fxx::meta::has_op_postdec;
+using fxx::meta::has_op_multiplies;
+using fxx::meta::has_op_divides;
+using fxx::meta::has_op_modulus;
+using fxx::meta::has_op_negate;
+using fxx::meta::has_op_promote;
+using fxx::meta::has_op_equal_to;
+using fxx::meta::has_op_not_equal_to;
+using fxx::meta::has_op_greater;
+using fxx::meta::has_op_less;
+using fxx::meta::has_op_greater_equal;
+using fxx::meta::has_op_less_equal;
+using fxx::meta::has_op_logical_and;
+using fxx::meta::has_op_logical_or;
+using fxx::meta::has_op_logical_not;
+using fxx::meta::has_op_bit_and;
+using fxx::meta::has_op_bit_or;
+using fxx::meta::has_op_bit_xor;
+using fxx::meta::has_op_bit_not;
+using fxx::meta::has_op_bit_left_shift;
+using fxx::meta::has_op_bit_right_shift;
+using fxx::meta::has_op_deref;
+using fxx::meta::has_op_addr_of;
+using fxx::meta::has_op_subscript;
+using fxx::meta::has_op_call;
+
+} // namespace fxx::meta
+
+export namespace fxx::tuple {
+
+using fxx::tuple::map_alloc_f;
+using fxx::tuple::map_alloc;
+using fxx::tuple::dup_alloc_f;
+using fxx::tuple::dup_alloc;
+using fxx::tuple::pick_alloc_f;
+using fxx::tuple::pick_alloc;
+using fxx::tuple::filter_alloc_f;
+using fxx::tuple::filter_alloc;
+using fxx::tuple::compare_f;
+using fxx::tuple::compare;
+using fxx::tuple::dup_f;
+using fxx::tuple::dup;
+using fxx::tuple::equal_f;
+using fxx::tuple::equal;
+using fxx::tuple::filter_f;
+using fxx::tuple::filter;
+using fxx::tuple::find_f;
+using fxx::tuple::find;
+using fxx::tuple::find_branchless_f;
+using fxx::tuple::find_branchless;
+using fxx::tuple::first_f;
+using fxx::tuple::first;
+using fxx::tuple::first_branchless_f;
+using fxx::tuple::first_branchless;
+using fxx::tuple::flip_f;
+using fxx::tuple::flip;
+using fxx::tuple::fold_f;
+using fxx::tuple::fold;
+using fxx::tuple::fold_tree_f;
+using fxx::tuple::fold_tree;
+using fxx::tuple::fold_until_f;
+using fxx::tuple::fold_until;
+using fxx::tuple::first_fold_f;
+using fxx::tuple::first_fold;
+using fxx::tuple::for_each_f;
+using fxx::tuple::for_each;
+using fxx::tuple::hash_f;
+using fxx::tuple::hash;
+using fxx::tuple::hasher;
+using fxx::tuple::less_f;
+using fxx::tuple::less;
+using fxx::tuple::map_f;
+using fxx::tuple::map;
+using fxx::tuple::map_inplace_f;
+using fxx::tuple::map_inplace;
+using fxx::tuple::thread_executor;
+using fxx::tuple::inline_executor;
+using fxx::tuple::par_map_f;
+using fxx::tuple::par_map;
+using fxx::tuple::par_for_each_f;
+using fxx::tuple::par_for_each;
+using fxx::tuple::pick_f;
+using fxx::tuple::pick;
+using fxx::tuple::pipeline;
+using fxx::tuple::pipe;
+using fxx::tuple::reduce_f;
+using fxx::tuple::reduce;
+using fxx::tuple::reduce_tree_f;
+using fxx::tuple::reduce_tree;
+using fxx::tuple::serialized_size;
+using fxx::tuple::serialized_size_of;
+using fxx::tuple::serialize_f;
+using fxx::tuple::serialize;
+using fxx::tuple::deserialize_f;
+using fxx::tuple::deserialize;
+using fxx::tuple::serialize_range_f;
+using fxx::tuple::serialize_range;
+using fxx::tuple::deserialize_range_f;
+using fxx::tuple::deserialize_range;
+using fxx::tuple::view_serialized_f;
+using fxx::tuple::view_serialized;
+using fxx::tuple::skip_f;
+using fxx::tuple::skip;
+using fxx::tuple::slice_f;
+using fxx::tuple::slice;
+using fxx::tuple::take_f;
+using fxx::tuple::take;
+using fxx::tuple::transpose_f;
+using fxx::tuple::transpose;
+using fxx::tuple::visit_at_f;
+using fxx::tuple::visit_at;
+using fxx::tuple::first_visit_f;
+using fxx::tuple::first_visit;
+using fxx::tuple::when_all_f;
+using fxx::tuple::when_all;
+using fxx::tuple::zip_f;
+using fxx::tuple::zip;
+using fxx::tuple::zip_transform_f;
+using fxx::tuple::zip_transform;
+
+#ifdef FXX_TUPLE_WHEN_ALL_CORO
+using fxx::tuple::co_when_all;
+using fxx::tuple::when_all_awaiter;
+#endif
+
+} // namespace fxx::tuple
+
+export namespace fxx::tuple::views {
+
+using fxx::tuple::views::index_view;
+using fxx::tuple::views::get;
+using fxx::tuple::views::pick_f;
+using fxx::tuple::views::slice_f;
+using fxx::tuple::views::take_f;
+using fxx::tuple::views::skip_f;
+using fxx::tuple::views::flip_f;
+using fxx::tuple::views::pick;
+using fxx::tuple::views::slice;
+using fxx::tuple::views::take;
+using fxx::tuple::views::skip;
+using fxx::tuple::views::flip;
+using fxx::tuple::views::tie;
+using fxx::tuple::views::materialize;
+using fxx::tuple::views::serialized_view;
+
+} // namespace fxx::tuple::views
+
+export namespace fxx::tuple::pipes {
+
+using fxx::tuple::pipes::map_f;
+using fxx::tuple::pipes::transform_f;
+using fxx::tuple::pipes::filter_f;
+using fxx::tuple::pipes::filter_elements_f;
+using fxx::tuple::pipes::fold_f;
+using fxx::tuple::pipes::for_each_f;
+using fxx::tuple::pipes::map;
+using fxx::tuple::pipes::transform;
+using fxx::tuple::pipes::filter;
+using fxx::tuple::pipes::fold;
+using fxx::tuple::pipes::for_each;
+
+} // namespace fxx::tuple::pipes
@@ -0,0 +1,78 @@
+# Generated-code regression check for a single kernel.
+#
+# Compiles KERNELS at -O2 to assembly, and checks that fxx_<KERNEL> contains no calls and no stack
+# accesses, and has no more instructions than its hand-written reference ref_<KERNEL>. Expects
+# x86-64 assembly in AT&T syntax, as emitted by GCC and Clang.
+#
+# Usage: cmake -DCOMPILER=<path> -DINCLUDE=<dir> -DKERNELS=<file> -DKERNEL=<name> -DOUTPUT=<file>
+#              -P check.cmake
+
+foreach (var COMPILER INCLUDE KERNELS KERNEL OUTPUT)
+    if (NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not defined.")
+    endif ()
+endforeach ()
+
+execute_process(
+    COMMAND ${COMPILER} -std=c++17 -O2 -S -I${INCLUDE} ${KERNELS} -o ${OUTPUT}
+    RESULT_VARIABLE status
+    ERROR_VARIABLE errors
+)
+if (NOT status EQUAL 0)
+    message(FATAL_ERROR "Compiling ${KERNELS} failed:\n${errors}")
+endif ()
+
+file(STRINGS ${OUTPUT} lines)
+
+# Extract the instructions of a function from the assembly.
+function(fxx_codegen_body symbol out)
+    set(body)
+    set(inside OFF)
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^_?${symbol}:")
+            set(inside ON)
+        elseif (inside AND line MATCHES "^\t\\.size\t|^\t\\.cfi_endproc")
+            break()
+        elseif (inside AND line MATCHES "^\t[a-z]")
+            list(APPEND body "${line}")
+        endif ()
+    endforeach ()
+
+    if (NOT body)
+        message(FATAL_ERROR "Function ${symbol} not found in ${OUTPUT}.")
+    endif ()
+    set(${out} "${body}" PARENT_SCOPE)
+endfunction()
+
+fxx_codegen_body(fxx_${KERNEL} actual)
+fxx_codegen_body(ref_${KERNEL} expected)
+
+string(REPLACE ";" "\n" listing "${actual}")
+set(failed OFF)
+
+foreach (line IN LISTS actual)
+    if (line MATCHES "^\tcall" OR line MATCHES "^\tjmp[a-z]*\t[^.]")
+        message(SEND_ERROR "fxx_${KERNEL} calls out of line: ${line}")
+        set(failed ON)
+    endif ()
+    if (line MATCHES "%[re]?sp|%[re]?bp")
+        message(SEND_ERROR "fxx_${KERNEL} accesses the stack: ${line}")
+        set(failed ON)
+    endif ()
+endforeach ()
+
+list(LENGTH actual actual_count)
+list(LENGTH expected expected_count)
+if (actual_count GREATER expected_count)
+    message(SEND_ERROR
+        "fxx_${KERNEL} has ${actual_count} instructions, ref_${KERNEL} has ${expected_count}."
+    )
+    set(failed ON)
+endif ()
+
+if (failed)
+    string(REPLACE ";" "\n" reference "${expected}")
+    message(FATAL_ERROR "fxx_${KERNEL}:\n${listing}\nref_${KERNEL}:\n${reference}")
+endif ()
+
+message(STATUS "fxx_${KERNEL}: ${actual_count} instructions, ref_${KERNEL}: ${expected_count}.")
@@ -0,0 +1,99 @@
+// Kernels for the generated-code regression checks.
+//
+// Every fxx_<name> kernel is checked against its hand-written ref_<name> counterpart: at -O2, it
+// must not contain calls or stack accesses, and must not be longer than the reference.
+
+#include <fxx/tuple/find.h>
+#include <fxx/tuple/flip.h>
+#include <fxx/tuple/fold.h>
+#include <fxx/tuple/map.h>
+#include <fxx/tuple/pick.h>
+#include <fxx/tuple/reduce.h>
+
+#include <functional>
+// std::plus
+#include <tuple>
+// std::(get, make_tuple, tuple)
+
+#include <cstddef>
+// std::size_t
+
+using tuple4 = std::tuple<int, int, int, int>;
+using tuple4d = std::tuple<double, double, double, double>;
+
+extern "C" {
+
+int fxx_fold(const tuple4& t) {
+    return fxx::tuple::fold(std::plus{}, 0, t);
+}
+int ref_fold(const tuple4& t) {
+    return std::get<0>(t) + std::get<1>(t) + std::get<2>(t) + std::get<3>(t);
+}
+
+double fxx_fold_double(const tuple4d& t) {
+    return fxx::tuple::fold(std::plus{}, 0.0, t);
+}
+double ref_fold_double(const tuple4d& t) {
+    return 0.0 + std::get<0>(t) + std::get<1>(t) + std::get<2>(t) + std::get<3>(t);
+}
+
+std::size_t fxx_fold_count(const tuple4d& t) {
+    return fxx::tuple::fold(
+        [](std::size_t acc, const double& x) { return acc + (x > 0.0 ? 1 : 0); },
+        std::size_t{0},
+        t
+    );
+}
+std::size_t ref_fold_count(const tuple4d& t) {
+    return std::size_t{0}
+        + (std::get<0>(t) > 0.0 ? 1 : 0)
+        + (std::get<1>(t) > 0.0 ? 1 : 0)
+        + (std::get<2>(t) > 0.0 ? 1 : 0)
+        + (std::get<3>(t) > 0.0 ? 1 : 0);
+}
+
+int fxx_reduce(const tuple4& t) {
+    return fxx::tuple::reduce(std::plus{}, t);
+}
+int ref_reduce(const tuple4& t) {
+    return std::get<0>(t) + std::get<1>(t) + std::get<2>(t) + std::get<3>(t);
+}
+
+void fxx_map(const tuple4& t, tuple4* out) {
+    *out = fxx::tuple::map([](int x) { return 2 * x + 1; }, t);
+}
+void ref_map(const tuple4& t, tuple4* out) {
+    *out = std::make_tuple(
+        2 * std::get<0>(t) + 1,
+        2 * std::get<1>(t) + 1,
+        2 * std::get<2>(t) + 1,
+        2 * std::get<3>(t) + 1
+    );
+}
+
+std::size_t fxx_find(int x, const tuple4& t) {
+    return fxx::tuple::find(x, t).value_or(4);
+}
+std::size_t ref_find(int x, const tuple4& t) {
+    if (std::get<0>(t) == x) return 0;
+    if (std::get<1>(t) == x) return 1;
+    if (std::get<2>(t) == x) return 2;
+    if (std::get<3>(t) == x) return 3;
+    return 4;
+}
+
+void fxx_pick(const tuple4& t, std::tuple<int, int>* out) {
+    *out = fxx::tuple::pick<3, 0>(t);
+}
+void ref_pick(const tuple4& t, std::tuple<int, int>* out) {
+    *out = std::make_tuple(std::get<3>(t), std::get<0>(t));
+}
+
+void fxx_flip(const tuple4& t, tuple4* out) {
+    *out = fxx::tuple::flip(t);
+}
+void ref_flip(const tuple4& t, tuple4* out) {
+    *out = std::make_tuple(std::get<3>(t), std::get<2>(t), std::get<1>(t), std::get<0>(t));
+}
+
+} // extern "C"
@@ -1,4 +1,6 @@
 // Enables static testing
 #define FXX_TEST_STATIC
 
-#include <fxx/cxx/is_nothrow_convertible.h>
\ No newline at end of file
+#include <fxx/cxx/countr_zero.h>
+#include <fxx/cxx/is_nothrow_convertible.h>
+#include <fxx/cxx/span.h>
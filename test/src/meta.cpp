@@ -1,4 +1,310 @@
 // Enables static testing
 #define FXX_TEST_STATIC
 
-#include <fxx/meta.h>
\ No newline at end of file
+#include <fxx/meta.h>
+
+using fxx::meta::all;
+using fxx::meta::any;
+using fxx::meta::count_if;
+
+#include <functional>
+// std::greater
+#include <tuple>
+// std::(tuple, tuple_size_v)
+#include <type_traits>
+// std::(bool_constant, common_type_t, integral_constant, is_same_v)
+#include <utility>
+// std::(index_sequence, make_index_sequence)
+
+#include <cstddef>
+// std::size_t
+
+//--------------------------------------------------------------------------------------------------
+// DEPTH REGRESSION USING STATIC ASSERTIONS
+//--------------------------------------------------------------------------------------------------
+
+namespace {
+
+// Number of elements in the large tuples (exceeds the default -ftemplate-depth).
+constexpr std::size_t large = 1024;
+
+template<std::size_t N>
+using index_t = std::integral_constant<std::size_t, N>;
+
+// Dispatch case.
+template<std::size_t, class>
+struct iota_tuple_impl {};
+
+// Variadic case.
+template<std::size_t Start, std::size_t... Ns>
+struct iota_tuple_impl<Start, std::index_sequence<Ns...>> {
+    using type = std::tuple<index_t<Start + Ns>...>;
+};
+
+// Tuple of index types [Start, Start + Length).
+template<std::size_t Start, std::size_t Length>
+using iota_tuple = typename iota_tuple_impl<Start, std::make_index_sequence<Length>>::type;
+
+// Dispatch case.
+template<class>
+struct reverse_iota_tuple_impl {};
+
+// Variadic case.
+template<std::size_t... Ns>
+struct reverse_iota_tuple_impl<std::index_sequence<Ns...>> {
+    using type = std::tuple<index_t<sizeof...(Ns) - 1 - Ns>...>;
+};
+
+// Tuple of index types [0, Length) in reverse order.
+template<std::size_t Length>
+using reverse_iota_tuple = typename reverse_iota_tuple_impl<
+    std::make_index_sequence<Length>
+>::type;
+
+// Indicates whether an index type is even.
+template<class Index>
+using is_even_t = std::bool_constant<Index::value % 2 == 0>;
+
+// Mirrors an index in [0, large).
+template<std::size_t N>
+using reverse_index_t = index_t<large - 1 - N>;
+
+// Indicates whether an index type is the last index of the large tuples.
+template<class Index>
+using is_last_t = std::bool_constant<Index::value == large - 1>;
+
+// Pack adaptors for the predicate combinators.
+template<class... Ts>
+using any_last_t = any<is_last_t, Ts...>;
+template<class... Ts>
+using all_last_t = all<is_last_t, Ts...>;
+template<class... Ts>
+using count_even_t = count_if<is_even_t, Ts...>;
+
+// Uses an index type as its own sorting key.
+template<class Index>
+using index_key_t = Index;
+
+// Combines two index types into the larger one.
+template<class Lhs, class Rhs>
+using max_index_t = index_t<(Lhs::value > Rhs::value ? Lhs::value : Rhs::value)>;
+
+} // namespace
+
+namespace fxx { namespace meta {
+
+// any
+static_assert(
+    apply_t<any_last_t, iota_tuple<0, large>>::value
+    && !apply_t<any_last_t, iota_tuple<0, large - 1>>::value,
+    "fxx::meta::any: Large case"
+);
+
+// all
+static_assert(
+    !apply_t<all_last_t, iota_tuple<0, large>>::value
+    && apply_t<all_last_t, tuple_dup_t<large, std::tuple<index_t<large - 1>>>>::value,
+    "fxx::meta::all: Large case"
+);
+
+// count_if
+static_assert(
+    apply_t<count_even_t, iota_tuple<0, large>>::value == large / 2,
+    "fxx::meta::count_if: Large case"
+);
+
+// first
+static_assert(
+    first<is_last_t, iota_tuple<0, large>>::value
+    && first<is_last_t, iota_tuple<0, large>>::index == large - 1
+    && !first<is_last_t, iota_tuple<0, large - 1>>::value,
+    "fxx::meta::first: Large case"
+);
+
+// reverse_index_sequence_t
+static_assert(
+    std::is_same_v<
+        map_index_sequence_t<reverse_index_t, std::make_index_sequence<large>>,
+        reverse_index_sequence_t<std::make_index_sequence<large>>
+    >,
+    "fxx::meta::reverse_index_sequence_t: Large case"
+);
+
+// rotate_index_sequence_t
+static_assert(
+    std::is_same_v<
+        concat_index_sequence_t<make_index_range<24, large - 24>, std::make_index_sequence<24>>,
+        rotate_index_sequence_t<24, std::make_index_sequence<large>>
+    >,
+    "fxx::meta::rotate_index_sequence_t: Large case"
+);
+
+// interleave_index_sequence_t
+static_assert(
+    std::is_same_v<
+        std::make_index_sequence<large>,
+        interleave_index_sequence_t<
+            scale_index_sequence_t<2, std::make_index_sequence<large / 2>>,
+            shift_index_sequence_t<
+                1,
+                scale_index_sequence_t<2, std::make_index_sequence<large / 2>>
+            >
+        >
+    >,
+    "fxx::meta::interleave_index_sequence_t: Large case"
+);
+
+// type_at_t
+static_assert(
+    std::is_same_v<index_t<large - 1>, type_at_t<large - 1, iota_tuple<0, large>>>,
+    "fxx::meta::type_at_t: Large case"
+);
+
+// tuple_pick_t
+static_assert(
+    std::is_same_v<
+        std::tuple<index_t<1023>, index_t<0>, index_t<512>, index_t<0>>,
+        tuple_pick_t<iota_tuple<0, large>, 1023, 0, 512, 0>
+    >,
+    "fxx::meta::tuple_pick_t: Large case"
+);
+
+// tuple_flip_t
+static_assert(
+    std::is_same_v<reverse_iota_tuple<large>, tuple_flip_t<iota_tuple<0, large>>>,
+    "fxx::meta::tuple_flip_t: Large case"
+);
+static_assert(
+    std::is_same_v<iota_tuple<0, large>, tuple_flip_t<tuple_flip_t<iota_tuple<0, large>>>>,
+    "fxx::meta::tuple_flip_t: Large involution case"
+);
+
+// tuple_skip_t
+static_assert(
+    std::is_same_v<iota_tuple<1000, large - 1000>, tuple_skip_t<1000, iota_tuple<0, large>>>,
+    "fxx::meta::tuple_skip_t: Large case"
+);
+
+// tuple_take_t
+static_assert(
+    std::is_same_v<iota_tuple<0, 1000>, tuple_take_t<1000, iota_tuple<0, large>>>,
+    "fxx::meta::tuple_take_t: Large case"
+);
+
+// tuple_slice_t
+static_assert(
+    std::is_same_v<iota_tuple<24, 1000>, tuple_slice_t<24, 1000, iota_tuple<0, large>>>,
+    "fxx::meta::tuple_slice_t: Large case"
+);
+
+// tuple_reduce_tree_t
+static_assert(
+    std::is_same_v<index_t<large - 1>, tuple_reduce_tree_t<max_index_t, iota_tuple<0, large>>>,
+    "fxx::meta::tuple_reduce_tree_t: Large case"
+);
+static_assert(
+    std::is_same_v<
+        long long,
+        tuple_reduce_tree_t<
+            std::common_type_t,
+            tuple_dup_t<large, std::tuple<char, int, long long>>
+        >
+    >,
+    "fxx::meta::tuple_reduce_tree_t: Large common type case"
+);
+
+// tuple_fold_tree_t
+static_assert(
+    std::is_same_v<
+        index_t<large>,
+        tuple_fold_tree_t<max_index_t, index_t<large>, reverse_iota_tuple<large>>
+    >,
+    "fxx::meta::tuple_fold_tree_t: Large case"
+);
+
+// tuple_filter_t
+static_assert(
+    std::is_same_v<
+        tuple_take_t<4, tuple_filter_t<is_even_t, iota_tuple<0, large>>>,
+        std::tuple<index_t<0>, index_t<2>, index_t<4>, index_t<6>>
+    >,
+    "fxx::meta::tuple_filter_t: Large case"
+);
+static_assert(
+    std::tuple_size_v<tuple_filter_t<is_even_t, iota_tuple<0, large>>> == large / 2,
+    "fxx::meta::tuple_filter_t: Large size case"
+);
+
+// tuple_sort_indices_t
+static_assert(
+    std::is_same_v<
+        map_index_sequence_t<reverse_index_t, std::make_index_sequence<large>>,
+        tuple_sort_indices_t<index_key_t, reverse_iota_tuple<large>>
+    >,
+    "fxx::meta::tuple_sort_indices_t: Large case"
+);
+
+// tuple_sort_t
+static_assert(
+    std::is_same_v<iota_tuple<0, large>, tuple_sort_t<index_key_t, reverse_iota_tuple<large>>>,
+    "fxx::meta::tuple_sort_t: Large case"
+);
+static_assert(
+    std::is_same_v<
+        reverse_iota_tuple<large>,
+        tuple_sort_t<index_key_t, iota_tuple<0, large>, std::greater<>>
+    >,
+    "fxx::meta::tuple_sort_t: Large descending case"
+);
+
+// tuple_contains
+static_assert(
+    tuple_contains_v<index_t<large - 1>, iota_tuple<0, large>>
+    && !tuple_contains_v<index_t<large>, iota_tuple<0, large>>,
+    "fxx::meta::tuple_contains: Large case"
+);
+
+// tuple_index_of
+static_assert(
+    tuple_index_of_v<index_t<0>, reverse_iota_tuple<large>> == large - 1
+    && tuple_index_of_v<index_t<large>, reverse_iota_tuple<large>> == large,
+    "fxx::meta::tuple_index_of: Large case"
+);
+
+// tuple_unique_t
+static_assert(
+    std::is_same_v<
+        iota_tuple<0, large / 2>,
+        tuple_unique_t<tuple_dup_t<2, iota_tuple<0, large / 2>>>
+    >,
+    "fxx::meta::tuple_unique_t: Large case"
+);
+
+// tuple_union_t
+static_assert(
+    std::is_same_v<
+        iota_tuple<0, large>,
+        tuple_union_t<iota_tuple<0, large / 2 + 1>, iota_tuple<large / 2, large / 2>>
+    >,
+    "fxx::meta::tuple_union_t: Large case"
+);
+
+// tuple_intersection_t
+static_assert(
+    std::is_same_v<
+        iota_tuple<large / 4, large / 4>,
+        tuple_intersection_t<iota_tuple<0, large / 2>, iota_tuple<large / 4, large / 2>>
+    >,
+    "fxx::meta::tuple_intersection_t: Large case"
+);
+
+// tuple_difference_t
+static_assert(
+    std::is_same_v<
+        iota_tuple<0, large / 4>,
+        tuple_difference_t<iota_tuple<0, large / 2>, iota_tuple<large / 4, large>>
+    >,
+    "fxx::meta::tuple_difference_t: Large case"
+);
+
+} } // namespace fxx::meta
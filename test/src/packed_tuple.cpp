@@ -0,0 +1,145 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+
+#include <string>
+// std::string
+#include <tuple>
+// std::(make_tuple, tuple, tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::(as_const, move)
+
+#include <fxx/packed_tuple.h>
+#include <fxx/tuple/dup.h>
+#include <fxx/tuple/find.h>
+#include <fxx/tuple/fold.h>
+#include <fxx/tuple/for_each.h>
+#include <fxx/tuple/map.h>
+#include <fxx/tuple/map_inplace.h>
+#include <fxx/tuple/pick.h>
+#include <fxx/tuple/views.h>
+#include <fxx/tuple/visit.h>
+
+using namespace std;
+using fxx::packed_tuple;
+
+TEST_CASE("fxx::packed_tuple", "[packed_tuple]") {
+    SECTION("Trivial case") {
+        packed_tuple<> t;
+
+        STATIC_REQUIRE(tuple_size_v<packed_tuple<>> == 0);
+        REQUIRE(t == packed_tuple<>{});
+    }
+
+    SECTION("Layout") {
+        using packed_t = packed_tuple<char, double, char, int, char>;
+
+        STATIC_REQUIRE(sizeof(packed_t) == 16);
+        STATIC_REQUIRE(sizeof(packed_t) < sizeof(tuple<char, double, char, int, char>));
+        STATIC_REQUIRE(is_same_v<
+            packed_t::storage_type,
+            tuple<double, int, char, char, char>
+        >);
+        STATIC_REQUIRE(packed_t::position<0> == 2);
+        STATIC_REQUIRE(packed_t::position<1> == 0);
+        STATIC_REQUIRE(packed_t::position<3> == 1);
+        STATIC_REQUIRE(packed_t::position<4> == 4);
+    }
+
+    SECTION("Regular case") {
+        packed_tuple<char, double, string, int> t('a', 1.5, "b", 2);
+
+        STATIC_REQUIRE(tuple_size_v<decltype(t)> == 4);
+        STATIC_REQUIRE(is_same_v<tuple_element_t<2, decltype(t)>, string>);
+        STATIC_REQUIRE(is_same_v<decltype(fxx::get<0>(t)), char&>);
+        STATIC_REQUIRE(is_same_v<decltype(fxx::get<1>(as_const(t))), const double&>);
+        STATIC_REQUIRE(is_same_v<decltype(fxx::get<2>(move(t))), string&&>);
+
+        REQUIRE(get<0>(t) == 'a');
+        REQUIRE(get<1>(t) == 1.5);
+        REQUIRE(get<2>(t) == "b");
+        REQUIRE(get<3>(t) == 2);
+
+        auto& [a, b, c, d] = t;
+        d = 3;
+        REQUIRE(get<3>(t) == 3);
+        REQUIRE(a == 'a');
+        REQUIRE(b == 1.5);
+        REQUIRE(c == "b");
+
+        auto u = t;
+        REQUIRE(u == t);
+        get<2>(u) = "c";
+        REQUIRE(u != t);
+    }
+
+    SECTION("Functors") {
+        using namespace fxx::tuple;
+
+        packed_tuple<char, double, int> t('a', 1.5, 2);
+
+        REQUIRE(map([](auto x) { return x + 1; }, t) == make_tuple(int('b'), 2.5, 3));
+        REQUIRE(fold([](double acc, auto x) { return acc + x; }, 0.0, t) == 'a' + 3.5);
+        REQUIRE(pick<2, 0>(t) == make_tuple(2, 'a'));
+        REQUIRE(find(2, t) == 2);
+
+        double sum = 0.0;
+        for_each([&](auto x) { sum += x; }, t);
+        REQUIRE(sum == 'a' + 3.5);
+
+        map_inplace([](auto& x) { x += 1; }, t);
+        REQUIRE(get<0>(t) == 'b');
+        REQUIRE(get<1>(t) == 2.5);
+        REQUIRE(get<2>(t) == 3);
+
+        REQUIRE(visit_at(1, [](auto x) { return double(x); }, t) == 2.5);
+    }
+
+    SECTION("Dup") {
+        packed_tuple<char, double, int> t('a', 1.5, 2);
+
+        auto r = fxx::tuple::dup<2>(t);
+
+        STATIC_REQUIRE(is_same_v<decltype(r), tuple<char, double, int, char, double, int>>);
+        REQUIRE(r == make_tuple('a', 1.5, 2, 'a', 1.5, 2));
+        REQUIRE(fxx::tuple::dup<2>(move(t)) == r);
+    }
+
+    SECTION("Views") {
+        namespace views = fxx::tuple::views;
+
+        packed_tuple<char, double, int> t('a', 1.5, 2);
+
+        auto v = views::flip(t);
+        REQUIRE(get<0>(v) == 2);
+        REQUIRE(get<2>(v) == 'a');
+
+        STATIC_REQUIRE(is_same_v<decltype(views::tie(v)), tuple<int&, double&, char&>>);
+        get<1>(views::tie(v)) = 2.5;
+        REQUIRE(get<1>(t) == 2.5);
+
+        auto m = views::materialize(views::pick<2, 0>(t));
+        STATIC_REQUIRE(is_same_v<decltype(m), tuple<int, char>>);
+        REQUIRE(m == make_tuple(2, 'a'));
+    }
+
+    SECTION("Counting") {
+        counted::reset();
+        packed_tuple<char, counted, double> t('a', counted{1}, 2.5);
+        REQUIRE(counted::copies == 0);
+        REQUIRE(counted::moves == 1);
+
+        counted::reset();
+        fxx::tuple::for_each([](auto&) {}, t);
+        fxx::tuple::map_inplace([](auto& x) { x = x; }, t);
+        REQUIRE(counted::copies == 1);
+        REQUIRE(counted::moves == 0);
+
+        counted::reset();
+        auto u = move(t);
+        REQUIRE(counted::copies == 0);
+        REQUIRE(counted::moves == 1);
+        REQUIRE(get<1>(u).value == 1);
+    }
+}
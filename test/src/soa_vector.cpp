@@ -0,0 +1,131 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+
+#include <numeric>
+// std::accumulate
+#include <stdexcept>
+// std::runtime_error
+#include <string>
+// std::string
+#include <tuple>
+// std::(get, make_tuple, tuple)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::(as_const, move)
+
+#include <fxx/soa_vector.h>
+#include <fxx/tuple/pick.h>
+#include <fxx/tuple/slice.h>
+
+using namespace std;
+using fxx::column_view;
+using fxx::soa_vector;
+
+namespace {
+
+// Type whose construction from an int throws for negative values.
+struct checked {
+    int value;
+
+    checked(int value) : value(value) {
+        if (value < 0) throw std::runtime_error("negative");
+    }
+};
+
+} // namespace
+
+TEST_CASE("fxx::soa_vector", "[soa_vector]") {
+    using record = tuple<int, double, string>;
+
+    SECTION("Trivial case") {
+        soa_vector<record> v;
+
+        REQUIRE(v.empty());
+        REQUIRE(v.size() == 0);
+        REQUIRE(v.column<0>().empty());
+    }
+
+    SECTION("Regular case") {
+        soa_vector<record> v;
+        v.reserve(4);
+        REQUIRE(v.capacity() >= 4);
+
+        v.push_back(make_tuple(1, 1.5, string("a")));
+        v.emplace_back(2, 2.5, "b");
+        const record r{3, 3.5, "c"};
+        v.push_back(r);
+
+        REQUIRE(v.size() == 3);
+
+        SECTION("Rows") {
+            static_assert(is_same_v<decltype(v[0]), tuple<int&, double&, string&>>);
+
+            get<0>(v[1]) = 20;
+            REQUIRE(v[1] == make_tuple(20, 2.5, string("b")));
+
+            const auto& cv = v;
+            static_assert(is_same_v<
+                decltype(cv[0]),
+                tuple<const int&, const double&, const string&>
+            >);
+            REQUIRE(get<2>(cv[2]) == "c");
+
+            v.pop_back();
+            REQUIRE(v.size() == 2);
+        }
+
+        SECTION("Columns") {
+            auto ints = v.column<0>();
+            REQUIRE(ints.size() == 3);
+            REQUIRE(ints.data() == get<0>(v.storage()).data());
+            REQUIRE(accumulate(ints.begin(), ints.end(), 0) == 6);
+
+            for (auto& x : v.column<1>()) x *= 2;
+            REQUIRE(get<1>(v[0]) == 3.0);
+        }
+
+        SECTION("Subsets") {
+            auto picked = fxx::tuple::pick<2, 0>(v.columns());
+            static_assert(is_same_v<
+                decltype(picked),
+                tuple<column_view<string>, column_view<int>>
+            >);
+            REQUIRE(get<0>(picked).data() == get<2>(v.storage()).data());
+            REQUIRE(get<1>(picked).data() == get<0>(v.storage()).data());
+
+            auto sliced = fxx::tuple::slice<1, 2>(as_const(v).columns());
+            static_assert(is_same_v<
+                decltype(sliced),
+                tuple<column_view<const double>, column_view<const string>>
+            >);
+            REQUIRE(get<0>(sliced).data() == get<1>(v.storage()).data());
+            REQUIRE(get<1>(sliced)[1] == "b");
+        }
+    }
+
+    SECTION("Counting") {
+        soa_vector<tuple<int, counted>> v;
+        v.reserve(2);
+        auto t = make_tuple(1, counted{1});
+        counted::reset();
+
+        v.push_back(t);
+        REQUIRE(counted::copies == 1);
+        REQUIRE(counted::moves == 0);
+
+        v.push_back(std::move(t));
+        REQUIRE(counted::copies == 1);
+        REQUIRE(counted::moves == 1);
+    }
+
+    SECTION("Rollback") {
+        soa_vector<tuple<int, checked>> v;
+        v.emplace_back(1, 1);
+
+        REQUIRE_THROWS_AS(v.emplace_back(2, -1), std::runtime_error);
+        REQUIRE(v.size() == 1);
+        REQUIRE(get<0>(v.storage()).size() == 1);
+        REQUIRE(get<1>(v.storage()).size() == 1);
+    }
+}
@@ -0,0 +1,163 @@
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+// std::size_t
+#include <memory>
+// std::allocator_arg_t
+#include <memory_resource>
+// std::pmr::(memory_resource, monotonic_buffer_resource, new_delete_resource,
+//            null_memory_resource, polymorphic_allocator, set_default_resource, string, vector)
+#include <string>
+// std::string
+#include <tuple>
+// std::(get, make_tuple, tuple, tuple_cat)
+#include <type_traits>
+// std::(decay_t, is_integral, is_same_v)
+#include <utility>
+// std::move
+
+#include <fxx/tuple/alloc.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+namespace {
+
+// Memory resource that counts the allocations it forwards to the new-delete resource.
+struct counting_resource : pmr::memory_resource {
+    size_t allocations = 0;
+    size_t deallocations = 0;
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Make any allocation from the default resource fail.
+struct no_default_resource {
+    pmr::memory_resource* previous = pmr::set_default_resource(pmr::null_memory_resource());
+
+    ~no_default_resource() { pmr::set_default_resource(previous); }
+};
+
+// Longer than any small-string buffer.
+const char* const long_a = "a string that does not fit into the small buffer";
+const char* const long_b = "another string that does not fit into the small buffer";
+
+} // namespace
+
+TEST_CASE("fxx::tuple::alloc", "[tuple]") {
+    counting_resource upstream;
+    using record_t = tuple<int, pmr::string, pmr::vector<int>>;
+    const record_t record{1, long_a, {1, 2, 3}};
+
+    SECTION("Map") {
+        pmr::monotonic_buffer_resource arena(&upstream);
+        no_default_resource guard;
+
+        const auto result = map_alloc(
+            &arena,
+            [](const auto& x) -> decltype(auto) { return x; },
+            record
+        );
+        STATIC_REQUIRE(is_same_v<decay_t<decltype(result)>, record_t>);
+
+        REQUIRE(result == record);
+        REQUIRE(get<1>(result).get_allocator().resource() == &arena);
+        REQUIRE(get<2>(result).get_allocator().resource() == &arena);
+        REQUIRE(upstream.allocations > 0);
+
+        SECTION("Computed") {
+            const auto lengths = make_tuple(size_t{64}, size_t{128});
+
+            // Computed results are built in the arena, because fn receives the allocator.
+            const auto strings = map_alloc(
+                &arena,
+                [](allocator_arg_t, const auto& alloc, size_t n) {
+                    return pmr::string(n, 'x', alloc);
+                },
+                lengths
+            );
+            STATIC_REQUIRE(is_same_v<decay_t<decltype(strings)>, tuple<pmr::string, pmr::string>>);
+
+            REQUIRE(get<0>(strings).size() == 64);
+            REQUIRE(get<1>(strings).size() == 128);
+            REQUIRE(get<0>(strings).get_allocator().resource() == &arena);
+            REQUIRE(get<1>(strings).get_allocator().resource() == &arena);
+        }
+    }
+
+    SECTION("Dup") {
+        pmr::monotonic_buffer_resource arena(&upstream);
+        const auto expected = tuple_cat(record, record);
+        auto source = record;
+        no_default_resource guard;
+
+        const auto result = dup_alloc<2>(&arena, record);
+        REQUIRE(result == expected);
+        REQUIRE(get<1>(result).get_allocator().resource() == &arena);
+        REQUIRE(get<4>(result).get_allocator().resource() == &arena);
+
+        SECTION("Rvalue") {
+            const auto moved = dup_alloc<2>(&arena, move(source));
+            REQUIRE(moved == result);
+            REQUIRE(get<4>(moved).get_allocator().resource() == &arena);
+        }
+    }
+
+    SECTION("Pick") {
+        pmr::monotonic_buffer_resource arena(&upstream);
+        const auto expected = make_tuple(pmr::string(long_a), pmr::string(long_a), 1);
+        no_default_resource guard;
+
+        const auto result = pick_alloc<1, 1, 0>(&arena, record);
+        REQUIRE(result == expected);
+        REQUIRE(get<0>(result).get_allocator().resource() == &arena);
+        REQUIRE(get<1>(result).get_allocator().resource() == &arena);
+    }
+
+    SECTION("Filter") {
+        pmr::monotonic_buffer_resource arena(&upstream);
+
+        const tuple<pmr::string, int, pmr::string> strings{long_a, 2, long_b};
+        no_default_resource guard;
+
+        const auto numbers = filter_alloc<is_integral>(&arena, strings);
+        REQUIRE(numbers == make_tuple(2));
+
+        const auto result = pick_alloc<2>(pmr::polymorphic_allocator<char>(&arena), strings);
+        REQUIRE(get<0>(result) == long_b);
+        REQUIRE(get<0>(result).get_allocator().resource() == &arena);
+    }
+
+    SECTION("Bulk release") {
+        {
+            pmr::monotonic_buffer_resource arena(&upstream);
+            for (int i = 0; i < 100; ++i) {
+                const auto result = pick_alloc<1, 2>(&arena, record);
+                REQUIRE(get<0>(result) == long_a);
+            }
+            // Individual deallocations only return memory to the arena.
+            REQUIRE(upstream.deallocations == 0);
+        }
+        REQUIRE(upstream.deallocations == upstream.allocations);
+    }
+
+    SECTION("Not allocator-aware") {
+        pmr::monotonic_buffer_resource arena(&upstream);
+
+        const tuple<int, string> plain{1, long_a};
+        const auto result = pick_alloc<1>(&arena, plain);
+        STATIC_REQUIRE(is_same_v<decay_t<decltype(result)>, tuple<string>>);
+        REQUIRE(get<0>(result) == long_a);
+        REQUIRE(upstream.allocations == 0);
+    }
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+// std::(is_sorted, sort)
+#include <cstdint>
+// std::(int16_t, int8_t, uint32_t, uint64_t, uint8_t)
+#include <string>
+// std::string
+#include <tuple>
+// std::(make_tuple, tie, tuple)
+#include <utility>
+// std::declval
+#include <vector>
+// std::vector
+
+#include <fxx/tuple/compare.h>
+
+using namespace std;
+
+// Check the functors against the std::tuple operators on all combinations of some values.
+template<class Tuple, class Values>
+static void check_lattice(const Values& values) {
+    vector<Tuple> keys;
+    for (auto a : values) {
+        for (auto b : values) {
+            for (auto c : values) {
+                keys.emplace_back(a, b, c);
+            }
+        }
+    }
+
+    for (const auto& l : keys) {
+        for (const auto& r : keys) {
+            const int expected = l < r ? -1 : r < l ? 1 : 0;
+            const int actual = fxx::tuple::compare(l, r);
+
+            REQUIRE((actual < 0) == (expected < 0));
+            REQUIRE((actual > 0) == (expected > 0));
+            REQUIRE(fxx::tuple::less(l, r) == (l < r));
+            REQUIRE(fxx::tuple::equal(l, r) == (l == r));
+        }
+    }
+}
+
+TEST_CASE("fxx::tuple::compare", "[tuple]") {
+    SECTION("Trivial case") {
+        REQUIRE(fxx::tuple::equal(make_tuple(), make_tuple()));
+        REQUIRE(fxx::tuple::compare(make_tuple(), make_tuple()) == 0);
+        REQUIRE(!fxx::tuple::less(make_tuple(), make_tuple()));
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            using key_t = tuple<std::uint32_t, std::uint32_t, std::uint64_t>;
+            STATIC_REQUIRE(fxx::tuple::detail::is_bytewise_order_v<key_t, key_t>);
+            STATIC_REQUIRE(fxx::tuple::detail::is_bytewise_equal_v<key_t, key_t>);
+
+            check_lattice<key_t>(vector<std::uint64_t>{0, 1, 0xffffffff});
+        }
+
+        SECTION("Signed") {
+            using key_t = tuple<std::int8_t, std::int64_t, std::int16_t>;
+            STATIC_REQUIRE(fxx::tuple::detail::is_bytewise_order_v<key_t, key_t>);
+
+            check_lattice<key_t>(vector<int>{-128, -1, 0, 1, 127});
+        }
+
+        SECTION("Unaligned") {
+            using key_t = tuple<std::uint8_t, std::uint64_t, bool>;
+            STATIC_REQUIRE(fxx::tuple::detail::is_bytewise_order_v<key_t, key_t>);
+
+            check_lattice<key_t>(vector<std::uint8_t>{0, 1, 0xff});
+        }
+
+        SECTION("References") {
+            std::uint32_t a = 1, b = 2;
+            const auto t = make_tuple(std::uint32_t{1}, std::uint32_t{3});
+
+            STATIC_REQUIRE(
+                fxx::tuple::detail::is_bytewise_order_v<decltype(tie(a, b)), decltype(t)>
+            );
+            REQUIRE(fxx::tuple::less(tie(a, b), t));
+            REQUIRE(!fxx::tuple::equal(tie(a, b), t));
+            b = 3;
+            REQUIRE(fxx::tuple::equal(tie(a, b), t));
+        }
+
+        SECTION("Generic") {
+            using key_t = tuple<double, int, double>;
+            STATIC_REQUIRE(!fxx::tuple::detail::is_bytewise_order_v<key_t, key_t>);
+            STATIC_REQUIRE(!fxx::tuple::detail::is_bytewise_equal_v<key_t, key_t>);
+            STATIC_REQUIRE(!fxx::tuple::detail::is_bytewise_order_v<tuple<int>, tuple<long>>);
+
+            check_lattice<key_t>(vector<int>{-1, 0, 2});
+            REQUIRE(fxx::tuple::less(make_tuple(string("a"), 2), make_tuple(string("b"), 1)));
+            REQUIRE(fxx::tuple::equal(make_tuple(string("a"), 2), make_tuple("a", 2)));
+            REQUIRE(fxx::tuple::compare(make_tuple(1, 2.5), make_tuple(1L, 2.0)) > 0);
+            REQUIRE(fxx::tuple::equal(make_tuple(1, 2.0), make_tuple(1L, 2.0f)));
+        }
+    }
+
+    SECTION("Sort") {
+        using key_t = tuple<std::uint32_t, std::uint32_t, std::uint64_t>;
+
+        vector<key_t> keys;
+        for (std::uint32_t i = 0; i < 64; ++i) {
+            keys.emplace_back(i * 7 % 5, i * 11 % 3, i * 13 % 17);
+        }
+
+        sort(keys.begin(), keys.end(), fxx::tuple::less_f{});
+        REQUIRE(is_sorted(keys.begin(), keys.end()));
+    }
+
+    SECTION("Constexpr") {
+        STATIC_REQUIRE(fxx::tuple::compare(make_tuple(1, -2), make_tuple(1, 3)) < 0);
+        STATIC_REQUIRE(fxx::tuple::less(make_tuple(1.0, 2), make_tuple(1.5, 0)));
+        STATIC_REQUIRE(fxx::tuple::equal(make_tuple(1.0, 2), make_tuple(1.0f, 2L)));
+    }
+
+    SECTION("Noexcept") {
+        STATIC_REQUIRE(noexcept(fxx::tuple::less(declval<tuple<int>>(), declval<tuple<int>>())));
+        STATIC_REQUIRE(noexcept(
+            fxx::tuple::equal(declval<tuple<string>>(), declval<tuple<string>>())
+        ));
+    }
+}
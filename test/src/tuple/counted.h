@@ -0,0 +1,36 @@
+#ifndef FXX_TEST_TUPLE_COUNTED_H
+#define FXX_TEST_TUPLE_COUNTED_H
+#pragma once
+
+#include <cstddef>
+// std::size_t
+
+// Element type that counts how often it was copied or moved.
+struct counted {
+    static inline std::size_t copies = 0;
+    static inline std::size_t moves = 0;
+
+    static void reset() {
+        copies = 0;
+        moves = 0;
+    }
+
+    int value;
+
+    counted(int value) : value(value) {}
+    counted(const counted& other) : value(other.value) { ++copies; }
+    counted(counted&& other) : value(other.value) { ++moves; }
+
+    counted& operator=(const counted& other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    counted& operator=(counted&& other) {
+        value = other.value;
+        ++moves;
+        return *this;
+    }
+};
+
+#endif
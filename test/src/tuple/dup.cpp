@@ -1,10 +1,13 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
+#include <string>
+// std::string
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/dup.h>
 
@@ -46,4 +49,51 @@ TEST_CASE("fxx::tuple::dup", "[tuple]") {
             REQUIRE(addressof(get<3>(std::forward<decltype(t_dup2)>(t_dup2))) == &b);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Counting") {
+        SECTION("Copies") {
+            auto t = make_tuple(counted{1}, counted{2});
+            counted::reset();
+
+            auto t_dup3 = dup<3>(t);
+
+            REQUIRE(get<4>(t_dup3).value == 1);
+            REQUIRE(get<5>(t_dup3).value == 2);
+            REQUIRE(counted::copies == 6);
+            REQUIRE(counted::moves == 0);
+        }
+
+        SECTION("Moves") {
+            auto t = make_tuple(counted{1}, counted{2});
+            counted::reset();
+
+            auto t_dup3 = dup<3>(move(t));
+
+            REQUIRE(get<4>(t_dup3).value == 1);
+            REQUIRE(get<5>(t_dup3).value == 2);
+            REQUIRE(counted::copies == 4);
+            REQUIRE(counted::moves == 6);
+        }
+
+        SECTION("Moved-from") {
+            auto t = make_tuple(string(64, 'a'), string(64, 'b'));
+
+            auto t_dup3 = dup<3>(move(t));
+
+            REQUIRE(get<0>(t_dup3) == string(64, 'a'));
+            REQUIRE(get<1>(t_dup3) == string(64, 'b'));
+            REQUIRE(get<2>(t_dup3) == string(64, 'a'));
+            REQUIRE(get<3>(t_dup3) == string(64, 'b'));
+            REQUIRE(get<4>(t_dup3) == string(64, 'a'));
+            REQUIRE(get<5>(t_dup3) == string(64, 'b'));
+        }
+    }
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(dup<3>(declval<tuple<int, int&>>())));
+        static_assert(noexcept(dup<3>(declval<tuple<int, int&>&>())));
+        static_assert(noexcept(dup<3>(declval<tuple<counted&>>())));
+        static_assert(!noexcept(dup<3>(declval<tuple<int, counted>>())));
+        static_assert(!noexcept(dup<3>(declval<tuple<int, counted>&>())));
+    }
+}
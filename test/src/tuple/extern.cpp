@@ -0,0 +1,65 @@
+#include <catch2/catch.hpp>
+
+#include <functional>
+// std::(multiplies, negate, plus)
+#include <string>
+// std::string
+#include <tuple>
+// std::(make_tuple, tuple)
+#include <utility>
+// std::move
+
+#include <fxx/tuple/extern.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+namespace {
+
+struct concat {
+    string operator()(string acc, const string& x) const { return acc + x; }
+};
+
+struct upper {
+    char operator()(char x) const { return static_cast<char>(x - 'a' + 'A'); }
+};
+
+using letters_t = tuple<char, char>;
+using words_t = tuple<string, string, string>;
+
+} // namespace
+
+FXX_EXTERN_TUPLE_MAP(upper, letters_t)
+FXX_EXTERN_TUPLE_FOLD(concat, string, words_t)
+FXX_EXTERN_TUPLE_PICK(words_t, 2, 0)
+
+FXX_INSTANTIATE_TUPLE_MAP(upper, letters_t)
+FXX_INSTANTIATE_TUPLE_FOLD(concat, string, words_t)
+FXX_INSTANTIATE_TUPLE_PICK(words_t, 2, 0)
+
+TEST_CASE("fxx::tuple extern templates", "[tuple]") {
+    SECTION("Instantiated") {
+        letters_t k{'a', 'b'};
+        words_t w{"a", "b", "c"};
+
+        REQUIRE(fxx::tuple::map(upper{}, k) == make_tuple('A', 'B'));
+        REQUIRE(fxx::tuple::map(upper{}, move(k)) == make_tuple('A', 'B'));
+        REQUIRE(fxx::tuple::fold(concat{}, string{}, w) == "abc");
+        REQUIRE(pick<2, 0>(w) == make_tuple("c", "a"));
+    }
+
+    SECTION("Cached") {
+        using fxx::tuple::detail::cache_double3_t;
+        using fxx::tuple::detail::cache_int2_t;
+
+        const cache_int2_t a{2, 3};
+        cache_double3_t b{1.0, 2.0, 3.0};
+
+        REQUIRE(fxx::tuple::map(negate<>{}, a) == make_tuple(-2, -3));
+        REQUIRE(fxx::tuple::fold(plus<>{}, 0, a) == 5);
+        REQUIRE(fxx::tuple::fold(multiplies<>{}, 1, a) == 6);
+        REQUIRE(fxx::tuple::fold(plus<>{}, 0.0, b) == 6.0);
+        REQUIRE(pick<2, 1, 0>(b) == make_tuple(3.0, 2.0, 1.0));
+        REQUIRE(pick<2, 1, 0>(move(b)) == make_tuple(3.0, 2.0, 1.0));
+    }
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+#include <tuple/unsafe.h>
+
+#include <string>
+// std::string
+#include <tuple>
+// std::(forward_as_tuple, get, make_tuple)
+#include <type_traits>
+// std::(is_arithmetic, is_class, is_lvalue_reference, is_same_v)
+#include <utility>
+// std::(declval, move)
+
+#include <fxx/tuple/filter.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::filter", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple(string("a"), string("b"));
+
+        auto t_f = filter<is_arithmetic>(std::forward<decltype(t)>(t));
+
+        static_assert(std::tuple_size_v<decltype(t_f)> == 0);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(1, string("a"), 2.5, string("b"));
+
+            auto t_f = filter<is_arithmetic>(t);
+
+            static_assert(is_same_v<decltype(t_f), tuple<int, double>>);
+            REQUIRE(t_f == make_tuple(1, 2.5));
+        }
+
+        SECTION("References") {
+            int a = 1, b = 2;
+            auto t = forward_as_tuple(a, move(b), a);
+
+            auto t_f = filter<is_lvalue_reference>(std::forward<decltype(t)>(t));
+
+            static_assert(is_same_v<decltype(t_f), tuple<int&, int&>>);
+            REQUIRE(addressof(get<0>(t_f)) == &a);
+            REQUIRE(addressof(get<1>(t_f)) == &a);
+        }
+    }
+
+    SECTION("Counting") {
+        SECTION("Copies") {
+            auto t = make_tuple(counted{1}, 2, counted{3});
+            counted::reset();
+
+            auto t_f = filter<is_class>(t);
+
+            REQUIRE(get<1>(t_f).value == 3);
+            REQUIRE(counted::copies == 2);
+            REQUIRE(counted::moves == 0);
+        }
+
+        SECTION("Moves") {
+            auto t = make_tuple(counted{1}, 2, counted{3});
+            counted::reset();
+
+            auto t_f = filter<is_class>(move(t));
+
+            REQUIRE(get<0>(t_f).value == 1);
+            REQUIRE(counted::copies == 0);
+            REQUIRE(counted::moves == 2);
+        }
+    }
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(filter<is_arithmetic>(declval<tuple<int, counted>>())));
+        static_assert(!noexcept(filter<is_class>(declval<tuple<int, counted>>())));
+    }
+}
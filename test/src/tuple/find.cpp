@@ -6,13 +6,22 @@
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/find.h>
 
 using namespace std;
 using namespace fxx::tuple;
 
+namespace {
+
+// Type with a potentially-throwing equality operator.
+struct throwing_eq {
+    friend bool operator==(int, const throwing_eq&) { return false; }
+};
+
+} // namespace
+
 TEST_CASE("fxx::tuple::find", "[tuple]") {
     SECTION("Trivial case") {
         auto t = make_tuple();
@@ -37,4 +46,19 @@ TEST_CASE("fxx::tuple::find", "[tuple]") {
         REQUIRE(idx);
         REQUIRE(idx.value() == 2);
     }
-}
\ No newline at end of file
+
+    SECTION("Homogeneous") {
+        const auto t = make_tuple(1, 2, 3, 2);
+
+        REQUIRE(find(2, t) == 1);
+        REQUIRE(find(3, t) == 2);
+        REQUIRE(find(4, t) == nullopt);
+        static_assert(find(3, make_tuple(1, 2, 3)) == 2);
+        static_assert(!find(4, make_tuple(1, 2, 3)));
+    }
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(find(1, declval<tuple<int, int>>())));
+        static_assert(!noexcept(find(1, declval<tuple<int, throwing_eq>>())));
+    }
+}
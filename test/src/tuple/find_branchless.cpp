@@ -0,0 +1,37 @@
+#include <catch2/catch.hpp>
+#include <tuple/unsafe.h>
+
+#include <optional>
+// std::(nullopt_t, optional)
+#include <tuple>
+// std::make_tuple
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::forward
+
+#include <fxx/tuple/find_branchless.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::find_branchless", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple();
+
+        auto idx = find_branchless(1, std::forward<decltype(t)>(t));
+
+        static_assert(std::is_same_v<decltype(idx), nullopt_t>);
+    }
+
+    SECTION("Regular case") {
+        auto t = make_tuple(1, 3, 2, 3);
+
+        auto idx = find_branchless(3, std::forward<decltype(t)>(t));
+
+        static_assert(std::is_same_v<decltype(idx), std::optional<std::size_t>>);
+        REQUIRE(idx);
+        REQUIRE(idx.value() == 1);
+        REQUIRE(!find_branchless(4, t));
+    }
+}
@@ -6,7 +6,7 @@
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/first.h>
 
@@ -52,4 +52,13 @@ TEST_CASE("fxx::tuple::first", "[tuple]") {
             REQUIRE(!idx);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Noexcept") {
+        auto nothrow_pred = [](int x) noexcept { return x > 1; };
+        auto throw_pred = [](int x) { return x > 1; };
+
+        static_assert(noexcept(first(nothrow_pred, declval<tuple<int, int>>())));
+        static_assert(!noexcept(first(throw_pred, declval<tuple<int, int>>())));
+        static_assert(noexcept(first(throw_pred, declval<tuple<>>())));
+    }
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch.hpp>
+#include <tuple/unsafe.h>
+
+#include <optional>
+// std::(nullopt_t, optional)
+#include <tuple>
+// std::(make_tuple, tuple)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::(declval, forward)
+
+#include <fxx/tuple/first_branchless.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::first_branchless", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple();
+
+        auto idx = first_branchless(
+            [](auto&&) { return true; },
+            std::forward<decltype(t)>(t)
+        );
+
+        static_assert(std::is_same_v<decltype(idx), nullopt_t>);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Match") {
+            auto t = make_tuple(1, 2, 3);
+
+            auto idx = first_branchless(
+                [](auto&& x) { return x > 1; },
+                std::forward<decltype(t)>(t)
+            );
+
+            static_assert(std::is_same_v<decltype(idx), std::optional<std::size_t>>);
+            REQUIRE(idx);
+            REQUIRE(idx.value() == 1);
+        }
+
+        SECTION("No match") {
+            auto t = make_tuple(1, 2, 3);
+
+            auto idx = first_branchless(
+                [](auto&& x) { return x > 3; },
+                std::forward<decltype(t)>(t)
+            );
+
+            REQUIRE(!idx);
+        }
+
+        SECTION("All evaluated") {
+            auto t = make_tuple(1, 2, 3, 4);
+            int calls = 0;
+
+            auto idx = first_branchless(
+                [&calls](auto&& x) { ++calls; return x > 1; },
+                t
+            );
+
+            REQUIRE(idx.value() == 1);
+            REQUIRE(calls == 4);
+        }
+
+        SECTION("Wide") {
+            auto t = tuple_cat(
+                make_tuple(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+                make_tuple(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+                make_tuple(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+                make_tuple(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1)
+            );
+
+            auto idx = first_branchless([](int x) { return x == 1; }, t);
+
+            REQUIRE(idx.value() == 63);
+        }
+
+        SECTION("Constexpr") {
+            static_assert(first_branchless([](int x) { return x > 1; }, make_tuple(1, 2)) == 1);
+        }
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_pred = [](int x) noexcept { return x > 1; };
+        auto throw_pred = [](int x) { return x > 1; };
+
+        static_assert(noexcept(first_branchless(nothrow_pred, declval<tuple<int, int>>())));
+        static_assert(!noexcept(first_branchless(throw_pred, declval<tuple<int, int>>())));
+    }
+}
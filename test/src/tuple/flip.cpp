@@ -1,10 +1,11 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/flip.h>
 
@@ -36,4 +37,37 @@ TEST_CASE("fxx::tuple::flip", "[tuple]") {
             REQUIRE(addressof(get<2>(std::forward<decltype(t_flip)>(t_flip))) == &a);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Counting") {
+        SECTION("Copies") {
+            auto t = make_tuple(counted{1}, counted{2}, counted{3});
+            counted::reset();
+
+            auto t_flip = flip(t);
+
+            REQUIRE(get<0>(t_flip).value == 3);
+            REQUIRE(get<2>(t_flip).value == 1);
+            REQUIRE(counted::copies == 3);
+            REQUIRE(counted::moves == 0);
+        }
+
+        SECTION("Moves") {
+            auto t = make_tuple(counted{1}, counted{2}, counted{3});
+            counted::reset();
+
+            auto t_flip = flip(move(t));
+
+            REQUIRE(get<0>(t_flip).value == 3);
+            REQUIRE(get<2>(t_flip).value == 1);
+            REQUIRE(counted::copies == 0);
+            REQUIRE(counted::moves == 3);
+        }
+    }
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(flip(declval<tuple<int, int>>())));
+        static_assert(noexcept(flip(declval<tuple<counted&, int>>())));
+        static_assert(!noexcept(flip(declval<tuple<int, counted>>())));
+        static_assert(!noexcept(flip(declval<tuple<int, counted>&>())));
+    }
+}
@@ -1,12 +1,15 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <functional>
 // std::(bind, minus, multiplies, placeholders::*, plus)
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
+#include <type_traits>
+// std::is_same_v
 #include <utility>
-// std::move
+// std::(declval, move)
 #include <vector>
 // std::vector
 
@@ -65,4 +68,46 @@ TEST_CASE("fxx::tuple::fold", "[tuple]") {
             REQUIRE(c == 0);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Homogeneous") {
+        SECTION("Values") {
+            const auto t = make_tuple(1.0, 2.0, 3.0, 4.0);
+
+            auto r = fold(std::minus{}, 10.0, t);
+
+            static_assert(std::is_same_v<decltype(r), double>);
+            REQUIRE(r == 0.0);
+        }
+
+        SECTION("Order") {
+            auto t = make_tuple(1, 2, 3);
+
+            auto r = fold([](int acc, int x) { return acc * 10 + x; }, 0, std::move(t));
+
+            REQUIRE(r == 123);
+        }
+
+        SECTION("Constexpr") {
+            static_assert(fold(std::plus{}, 1, make_tuple(2, 3, 4)) == 10);
+        }
+
+        SECTION("Accumulator reference") {
+            auto accumulate = [](int& acc, int x) -> int& { return acc += x; };
+
+            int acc = 0;
+            int& r = fold(accumulate, acc, make_tuple(1, 2, 3));
+
+            REQUIRE(&r == &acc);
+            REQUIRE(acc == 6);
+        }
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int x, int y) noexcept { return x + y; };
+        auto throw_fn = [](int x, int y) { return x + y; };
+
+        static_assert(noexcept(fold(nothrow_fn, 0, declval<tuple<int, int>>())));
+        static_assert(!noexcept(fold(throw_fn, 0, declval<tuple<int, int>>())));
+        static_assert(!noexcept(fold(throw_fn, declval<counted>(), declval<tuple<>>())));
+    }
+}
@@ -0,0 +1,65 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+#include <tuple/unsafe.h>
+
+#include <functional>
+// std::plus
+#include <string>
+// std::string
+#include <tuple>
+// std::make_tuple
+#include <utility>
+// std::(declval, forward)
+
+#include <fxx/tuple/fold_tree.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+// Folding function that records the shape of the folding tree.
+static string bracket(const string& x, const string& y) {
+    return "(" + x + "+" + y + ")";
+}
+
+TEST_CASE("fxx::tuple::fold_tree", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple();
+
+        auto r = fold_tree(
+            std::plus{},
+            1,
+            std::forward<decltype(t)>(t)
+        );
+
+        REQUIRE(r == 1);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(1, 2, 3, 4);
+
+            auto r = fold_tree(
+                std::plus{},
+                10,
+                std::forward<decltype(t)>(t)
+            );
+
+            REQUIRE(r == 20);
+        }
+
+        SECTION("Shape") {
+            auto t = make_tuple(string("a"), string("b"), string("c"), string("d"));
+
+            REQUIRE(fold_tree(bracket, string("i"), t) == "(i+((a+b)+(c+d)))");
+        }
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int x, int y) noexcept { return x + y; };
+        auto throw_fn = [](int x, int y) { return x + y; };
+
+        static_assert(noexcept(fold_tree(nothrow_fn, 0, declval<tuple<int, int>>())));
+        static_assert(!noexcept(fold_tree(throw_fn, 0, declval<tuple<int, int>>())));
+        static_assert(!noexcept(fold_tree(throw_fn, declval<counted>(), declval<tuple<>>())));
+    }
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+#include <tuple/unsafe.h>
+
+#include <optional>
+// std::(nullopt, optional)
+#include <tuple>
+// std::make_tuple
+#include <utility>
+// std::(declval, forward)
+
+#include <fxx/tuple/fold_until.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+// Folding function that sums up elements until it encounters a negative one.
+static constexpr auto sum_positive = [](int acc, int x) -> optional<int> {
+    if (x < 0) {
+        return nullopt;
+    }
+    return acc + x;
+};
+
+TEST_CASE("fxx::tuple::fold_until", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple();
+
+        auto r = fold_until(sum_positive, 1, std::forward<decltype(t)>(t));
+        auto [idx, acc] = first_fold(sum_positive, 1, std::forward<decltype(t)>(t));
+
+        REQUIRE(r == 1);
+        REQUIRE(!idx);
+        REQUIRE(acc == 1);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Complete") {
+            auto t = make_tuple(1, 2, 3);
+
+            auto [idx, acc] = first_fold(sum_positive, 0, std::forward<decltype(t)>(t));
+
+            REQUIRE(!idx);
+            REQUIRE(acc == 6);
+        }
+
+        SECTION("Stopped") {
+            auto t = make_tuple(1, -2, 3);
+
+            auto [idx, acc] = first_fold(sum_positive, 0, std::forward<decltype(t)>(t));
+
+            REQUIRE(idx);
+            REQUIRE(idx.value() == 1);
+            REQUIRE(acc == 1);
+        }
+
+        SECTION("Short-circuit") {
+            auto t = make_tuple(1, -2, 3, 4);
+            int calls = 0;
+
+            auto r = fold_until(
+                [&calls](int acc, int x) { ++calls; return sum_positive(acc, x); },
+                0,
+                std::forward<decltype(t)>(t)
+            );
+
+            REQUIRE(r == 1);
+            REQUIRE(calls == 2);
+        }
+
+        SECTION("Constexpr") {
+            static_assert(fold_until(sum_positive, 0, make_tuple(1, 2, -3, 4)) == 3);
+            static_assert(first_fold(sum_positive, 0, make_tuple(1, 2, -3, 4)).first == 2);
+        }
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int acc, int x) noexcept { return optional<int>(acc + x); };
+
+        static_assert(noexcept(fold_until(nothrow_fn, 0, declval<tuple<int, int>>())));
+        static_assert(!noexcept(fold_until(sum_positive, 0, declval<tuple<int, int>>())));
+        static_assert(!noexcept(fold_until(nothrow_fn, declval<counted>(), declval<tuple<>>())));
+    }
+}
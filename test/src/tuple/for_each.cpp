@@ -0,0 +1,73 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+
+#include <string>
+// std::(string, to_string)
+#include <tuple>
+// std::(forward_as_tuple, make_tuple)
+#include <utility>
+// std::(declval, move)
+
+#include <fxx/tuple/for_each.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::for_each", "[tuple]") {
+    SECTION("Trivial case") {
+        int calls = 0;
+
+        for_each([&](auto&&) { ++calls; }, make_tuple());
+
+        REQUIRE(calls == 0);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(1, string("a"), 2.5);
+            string out;
+
+            for_each([&](const auto& x) { out += to_string(sizeof(x)) + ","; return x; }, t);
+
+            REQUIRE(out == to_string(sizeof(int)) + "," + to_string(sizeof(string)) + ","
+                + to_string(sizeof(double)) + ",");
+        }
+
+        SECTION("References") {
+            int a = 1, b = 2;
+
+            for_each([](int&& x) { x *= 10; }, forward_as_tuple(move(a), move(b)));
+
+            REQUIRE(a == 10);
+            REQUIRE(b == 20);
+        }
+
+        SECTION("Constexpr") {
+            constexpr auto sum = [] {
+                int s = 0;
+                for_each([&](int x) { s += x; }, make_tuple(1, 2, 3));
+                return s;
+            }();
+
+            static_assert(sum == 6);
+        }
+    }
+
+    SECTION("Counting") {
+        auto t = make_tuple(counted{1}, counted{2});
+        counted::reset();
+
+        for_each([](const counted& x) { return x; }, t);
+
+        REQUIRE(counted::copies == 2);
+        REQUIRE(counted::moves == 0);
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int) noexcept {};
+        auto throw_fn = [](int) {};
+
+        static_assert(noexcept(for_each(nothrow_fn, declval<tuple<int, int>>())));
+        static_assert(!noexcept(for_each(throw_fn, declval<tuple<int, int>>())));
+    }
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <bitset>
+// std::bitset
+#include <cstdint>
+// std::(uint16_t, uint32_t, uint64_t)
+#include <string>
+// std::string
+#include <tuple>
+// std::(forward_as_tuple, make_tuple, tie, tuple)
+#include <unordered_map>
+// std::unordered_map
+#include <unordered_set>
+// std::unordered_set
+#include <utility>
+// std::declval
+
+#include <fxx/tuple/hash.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+// Average number of result bits that flip when a single input bit flips.
+template<class Fn>
+static double avalanche(Fn fn) {
+    std::size_t flips = 0;
+    for (std::uint64_t i = 0; i < 16; ++i) {
+        for (int bit = 0; bit < 64; ++bit) {
+            flips += bitset<64>(fn(i, 0) ^ fn(i, std::uint64_t{1} << bit)).count();
+        }
+    }
+    return static_cast<double>(flips) / (16 * 64);
+}
+
+TEST_CASE("fxx::tuple::hash", "[tuple]") {
+    SECTION("Trivial case") {
+        STATIC_REQUIRE(fxx::tuple::detail::is_bytewise_v<tuple<>>);
+
+        REQUIRE(fxx::tuple::hash(make_tuple()) == fxx::tuple::hash(make_tuple()));
+        REQUIRE(fxx::tuple::hash(make_tuple(), 1) != fxx::tuple::hash(make_tuple()));
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            using key_t = tuple<std::uint64_t, std::uint32_t, std::uint16_t>;
+            STATIC_REQUIRE(fxx::tuple::detail::is_bytewise_v<key_t>);
+
+            const key_t a{1, 2, 3}, b{1, 2, 3}, c{1, 3, 2};
+
+            REQUIRE(fxx::tuple::hash(a) == fxx::tuple::hash(b));
+            REQUIRE(fxx::tuple::hash(a) != fxx::tuple::hash(c));
+            REQUIRE(fxx::tuple::hash(a, 1) != fxx::tuple::hash(a));
+        }
+
+        SECTION("References") {
+            std::uint64_t x = 1;
+            std::uint32_t y = 2;
+
+            const auto h = fxx::tuple::hash(make_tuple(x, y));
+
+            REQUIRE(fxx::tuple::hash(tie(x, y)) == h);
+            REQUIRE(fxx::tuple::hash(forward_as_tuple(std::uint64_t{1}, y)) == h);
+        }
+
+        SECTION("Generic") {
+            using key_t = tuple<string, double>;
+            STATIC_REQUIRE(!fxx::tuple::detail::is_bytewise_v<key_t>);
+
+            const string s = "a";
+            const key_t a{"a", 1.0}, b{"a", 1.0}, c{"b", 1.0};
+
+            REQUIRE(fxx::tuple::hash(a) == fxx::tuple::hash(b));
+            REQUIRE(fxx::tuple::hash(a) != fxx::tuple::hash(c));
+            REQUIRE(fxx::tuple::hash(tie(s, get<1>(a))) == fxx::tuple::hash(a));
+        }
+    }
+
+    SECTION("Avalanche") {
+        const auto bytewise = avalanche([](std::uint64_t i, std::uint64_t flip) {
+            return fxx::tuple::hash(make_tuple(i ^ flip, std::uint32_t{7}));
+        });
+        const auto generic = avalanche([](std::uint64_t i, std::uint64_t flip) {
+            return fxx::tuple::hash(make_tuple(i ^ flip, string("x")));
+        });
+
+        REQUIRE(bytewise > 28.0);
+        REQUIRE(bytewise < 36.0);
+        REQUIRE(generic > 28.0);
+        REQUIRE(generic < 36.0);
+    }
+
+    SECTION("Hasher") {
+        using key_t = tuple<std::uint64_t, std::uint32_t>;
+
+        unordered_map<key_t, int, hasher<key_t>> map;
+        map[{1, 2}] = 3;
+        map[{2, 1}] = 4;
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.at({1, 2}) == 3);
+
+        unordered_set<tuple<string, int>, hasher<>> set{{"a", 1}, {"a", 1}, {"b", 1}};
+        REQUIRE(set.size() == 2);
+        REQUIRE(hasher<>{}(key_t{1, 2}) == hasher<key_t>{}(key_t{1, 2}));
+    }
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(fxx::tuple::hash(declval<tuple<int, long>>())));
+        static_assert(noexcept(fxx::tuple::hash(declval<tuple<string, double>>())));
+        static_assert(noexcept(hasher<tuple<int>>{}(declval<tuple<int>>())));
+    }
+}
@@ -1,12 +1,15 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <functional>
-// std::(bind, multiplies, placeholders::*, plus)
+// std::(bind, multiplies, negate, placeholders::*, plus)
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
+#include <type_traits>
+// std::is_same_v
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/map.h>
 
@@ -58,4 +61,47 @@ TEST_CASE("fxx::tuple::map", "[tuple]") {
             REQUIRE(addressof(get<2>(std::forward<decltype(t_m)>(t_m))) == &c);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Homogeneous") {
+        SECTION("Values") {
+            const auto t = make_tuple(1.0f, 2.0f, 3.0f, 4.0f);
+
+            auto t_m = map(std::bind(std::multiplies{}, std::placeholders::_1, 2.0), t);
+
+            static_assert(std::is_same_v<decltype(t_m), tuple<double, double, double, double>>);
+            REQUIRE(get<0>(t_m) == 2.0);
+            REQUIRE(get<1>(t_m) == 4.0);
+            REQUIRE(get<2>(t_m) == 6.0);
+            REQUIRE(get<3>(t_m) == 8.0);
+        }
+
+        SECTION("Order") {
+            auto t = make_tuple(1, 2, 3);
+            int calls = 0;
+
+            auto t_m = map([&](int x) { return x * 10 + calls++; }, std::move(t));
+
+            REQUIRE(get<0>(t_m) == 10);
+            REQUIRE(get<1>(t_m) == 21);
+            REQUIRE(get<2>(t_m) == 32);
+        }
+
+        SECTION("Constexpr") {
+            constexpr auto t_m = map(std::negate{}, make_tuple(1, 2, 3));
+
+            static_assert(get<0>(t_m) == -1);
+            static_assert(get<1>(t_m) == -2);
+            static_assert(get<2>(t_m) == -3);
+        }
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int x) noexcept { return x; };
+        auto throw_fn = [](int x) { return x; };
+        auto counted_fn = [](int x) noexcept { return counted{x}; };
+
+        static_assert(noexcept(map(nothrow_fn, declval<tuple<int, int>>())));
+        static_assert(!noexcept(map(throw_fn, declval<tuple<int, int>>())));
+        static_assert(!noexcept(map(counted_fn, declval<tuple<int, int>>())));
+    }
+}
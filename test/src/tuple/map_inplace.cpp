@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+
+#include <string>
+// std::string
+#include <tuple>
+// std::(forward_as_tuple, get, make_tuple, tie)
+#include <utility>
+// std::declval
+
+#include <fxx/tuple/map_inplace.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::map_inplace", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple();
+
+        map_inplace([](auto& x) { return x; }, t);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(1, string("a"), 2.5);
+
+            map_inplace([](const auto& x) { return x + x; }, t);
+
+            REQUIRE(t == make_tuple(2, string("aa"), 5.0));
+        }
+
+        SECTION("References") {
+            int a = 1;
+            string b = "a";
+
+            map_inplace([](auto& x) { x += x; }, tie(a, b));
+
+            REQUIRE(a == 2);
+            REQUIRE(b == "aa");
+        }
+
+        SECTION("Constexpr") {
+            constexpr auto t = [] {
+                auto t = make_tuple(1, 2, 3);
+                map_inplace([](int x) { return x * x; }, t);
+                return t;
+            }();
+
+            static_assert(get<2>(t) == 9);
+        }
+    }
+
+    SECTION("Counting") {
+        auto t = make_tuple(counted{1}, counted{2});
+        counted::reset();
+
+        map_inplace([](counted& x) { ++x.value; }, t);
+
+        REQUIRE(get<1>(t).value == 3);
+        REQUIRE(counted::copies == 0);
+        REQUIRE(counted::moves == 0);
+
+        map_inplace([](const counted& x) { return counted{x.value * 2}; }, t);
+
+        REQUIRE(get<0>(t).value == 4);
+        REQUIRE(counted::copies == 0);
+        REQUIRE(counted::moves == 2);
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int& x) noexcept { ++x; };
+        auto throw_fn = [](int x) { return x; };
+        auto counted_fn = [](const counted& x) noexcept { return counted{x.value}; };
+
+        static_assert(noexcept(map_inplace(nothrow_fn, declval<tuple<int, int>&>())));
+        static_assert(!noexcept(map_inplace(throw_fn, declval<tuple<int, int>&>())));
+        static_assert(!noexcept(map_inplace(counted_fn, declval<tuple<counted>&>())));
+    }
+}
@@ -0,0 +1,143 @@
+#include <catch2/catch.hpp>
+#include <tuple/unsafe.h>
+
+#include <atomic>
+// std::atomic
+#include <stdexcept>
+// std::runtime_error
+#include <string>
+// std::(string, to_string)
+#include <thread>
+// std::this_thread::*
+#include <tuple>
+// std::(forward_as_tuple, get, make_tuple)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::move
+
+#include <fxx/tuple/par_map.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+namespace {
+
+// Executor that counts the submitted tasks.
+struct counting_executor {
+    std::size_t tasks = 0;
+
+    template<class Task>
+    void operator()(Task&& task) {
+        ++tasks;
+        task();
+    }
+};
+
+// Executor that fails after a number of tasks.
+struct failing_executor {
+    std::size_t budget;
+
+    template<class Task>
+    void operator()(Task&& task) {
+        if (budget-- == 0) throw std::runtime_error("exhausted");
+        task();
+    }
+};
+
+} // namespace
+
+TEST_CASE("fxx::tuple::par_map", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple();
+
+        auto t_m = par_map(inline_executor{}, [](auto x) { return x; }, t);
+
+        static_assert(std::tuple_size_v<decltype(t_m)> == 0);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(1, 2.5, string("a"));
+            counting_executor executor;
+
+            auto t_m = par_map(executor, [](const auto& x) { return x + x; }, t);
+
+            static_assert(is_same_v<decltype(t_m), tuple<int, double, string>>);
+            REQUIRE(executor.tasks == 3);
+            REQUIRE(t_m == make_tuple(2, 5.0, string("aa")));
+        }
+
+        SECTION("References") {
+            int a = 1, b = 2;
+            auto t = forward_as_tuple(a, b);
+
+            auto t_m = par_map(inline_executor{}, [](int& x) -> int& { return x; }, t);
+
+            static_assert(is_same_v<decltype(t_m), tuple<int&, int&>>);
+            REQUIRE(addressof(get<0>(t_m)) == &a);
+            REQUIRE(addressof(get<1>(t_m)) == &b);
+        }
+
+        SECTION("Moves") {
+            auto t = make_tuple(string(64, 'a'), string(64, 'b'));
+
+            auto t_m = par_map(inline_executor{}, [](string&& x) { return move(x); }, move(t));
+
+            REQUIRE(get<0>(t_m) == string(64, 'a'));
+            REQUIRE(get<1>(t_m) == string(64, 'b'));
+        }
+    }
+
+    SECTION("Threads") {
+        auto t = make_tuple(1, 2, 3, 4);
+        std::atomic<int> arrived{0};
+
+        // Every task waits for all others, which only returns if all of them run concurrently.
+        auto t_m = par_map(
+            thread_executor{},
+            [&](int) {
+                ++arrived;
+                while (arrived.load() < 4) {
+                    std::this_thread::yield();
+                }
+                return std::this_thread::get_id();
+            },
+            t
+        );
+
+        REQUIRE(get<0>(t_m) != std::this_thread::get_id());
+        REQUIRE(get<0>(t_m) != get<1>(t_m));
+        REQUIRE(arrived == 4);
+    }
+
+    SECTION("Exceptions") {
+        auto t = make_tuple(0, 1, 2);
+        std::atomic<int> calls{0};
+
+        auto fn = [&](int x) {
+            ++calls;
+            if (x > 0) throw std::runtime_error(std::to_string(x));
+            return x;
+        };
+
+        SECTION("Lowest index") {
+            REQUIRE_THROWS_WITH(par_map(thread_executor{}, fn, t), "1");
+            REQUIRE(calls == 3);
+        }
+
+        SECTION("Submission") {
+            REQUIRE_THROWS_WITH(par_map(failing_executor{1}, fn, t), "exhausted");
+            REQUIRE(calls == 1);
+        }
+    }
+
+    SECTION("For each") {
+        auto t = make_tuple(1, 2, 3);
+        std::atomic<int> sum{0};
+
+        par_for_each(thread_executor{}, [&](int x) { sum += x; }, t);
+
+        REQUIRE(sum == 6);
+    }
+}
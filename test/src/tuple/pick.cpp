@@ -1,11 +1,16 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
+#include <type_traits>
+// std::(alignment_of, is_same_v)
 #include <utility>
-// std::move
+// std::(declval, move)
 
+#include <fxx/meta/indices.h>
+#include <fxx/meta/tuple.h>
 #include <fxx/tuple/pick.h>
 
 using namespace std;
@@ -43,5 +48,52 @@ TEST_CASE("fxx::tuple::pick", "[tuple]") {
             REQUIRE(addressof(get<1>(std::forward<decltype(t_dup2)>(t_dup2))) == &b);
             REQUIRE(addressof(get<2>(std::forward<decltype(t_dup2)>(t_dup2))) == &a);
         }
+
+        SECTION("Sorted") {
+            auto t = make_tuple(1, 'a', 2.5, short(3));
+
+            using seq_t = fxx::meta::tuple_sort_indices_t<alignment_of, decltype(t)>;
+            using pick_t = fxx::meta::apply_index_sequence_t<pick_f, seq_t>;
+            auto t_sorted = pick_t{}(t);
+
+            static_assert(is_same_v<
+                decltype(t_sorted),
+                fxx::meta::tuple_sort_t<alignment_of, decltype(t)>
+            >);
+            REQUIRE(t_sorted == make_tuple('a', short(3), 1, 2.5));
+        }
+    }
+
+    SECTION("Counting") {
+        SECTION("Copies") {
+            auto t = make_tuple(counted{1}, counted{2}, counted{3});
+            counted::reset();
+
+            auto t_pick = pick<2, 0>(t);
+
+            REQUIRE(get<0>(t_pick).value == 3);
+            REQUIRE(get<1>(t_pick).value == 1);
+            REQUIRE(counted::copies == 2);
+            REQUIRE(counted::moves == 0);
+        }
+
+        SECTION("Moves") {
+            auto t = make_tuple(counted{1}, counted{2}, counted{3});
+            counted::reset();
+
+            auto t_pick = pick<2, 0>(move(t));
+
+            REQUIRE(get<0>(t_pick).value == 3);
+            REQUIRE(get<1>(t_pick).value == 1);
+            REQUIRE(counted::copies == 0);
+            REQUIRE(counted::moves == 2);
+        }
+    }
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(pick<1, 0>(declval<tuple<int, int>>())));
+        static_assert(noexcept(pick<1, 0>(declval<tuple<counted&, int>>())));
+        static_assert(!noexcept(pick<1, 0>(declval<tuple<int, counted>>())));
+        static_assert(!noexcept(pick<1, 0>(declval<tuple<int, counted>&>())));
     }
-}
\ No newline at end of file
+}
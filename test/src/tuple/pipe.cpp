@@ -0,0 +1,146 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+
+#include <array>
+// std::array
+#include <string>
+// std::string
+#include <tuple>
+// std::(get, make_tuple, tuple)
+#include <type_traits>
+// std::(is_integral, is_same_v)
+#include <utility>
+// std::as_const
+#include <vector>
+// std::vector
+
+#include <fxx/cxx/span.h>
+#include <fxx/soa_vector.h>
+#include <fxx/tuple/pipe.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+namespace {
+
+using row_t = tuple<int, double>;
+
+// Rows that span several blocks, including a partial one.
+vector<row_t> make_rows(int n) {
+    vector<row_t> rows;
+    for (int i = 0; i < n; ++i) {
+        rows.emplace_back(i % 7 - 3, 0.5 * i);
+    }
+    return rows;
+}
+
+} // namespace
+
+TEST_CASE("fxx::tuple::pipe", "[tuple]") {
+    const auto rows = make_rows(5000);
+
+    SECTION("Trivial case") {
+        const auto count = pipe(pipes::fold([](int acc, const auto&) { return acc + 1; }, 0));
+
+        REQUIRE(count(vector<row_t>{}) == 0);
+        REQUIRE(count(rows) == 5000);
+    }
+
+    SECTION("Regular case") {
+        const auto p = pipe(
+            pipes::map([](auto x) { return x * 2; }),
+            pipes::filter([](const auto& row) { return get<0>(row) > 0; }),
+            pipes::fold([](double acc, const auto& row) { return acc + get<1>(row); }, 0.0)
+        );
+
+        double expected = 0.0;
+        for (const auto& [x, y] : rows) {
+            if (x * 2 > 0) {
+                expected += y * 2;
+            }
+        }
+
+        REQUIRE(p(rows) == expected);
+        REQUIRE(p(span<const row_t>(rows).subspan(3, 100)) == p(vector<row_t>(
+            rows.begin() + 3,
+            rows.begin() + 103
+        )));
+    }
+
+    SECTION("Transform") {
+        const auto p = pipe(
+            pipes::transform([](const auto& row) { return make_tuple(get<1>(row), get<0>(row)); }),
+            pipes::filter<is_integral>(),
+            pipes::fold([](int acc, const tuple<int>& row) { return acc + get<0>(row); }, 0)
+        );
+
+        int expected = 0;
+        for (const auto& row : rows) {
+            expected += get<0>(row);
+        }
+
+        REQUIRE(p(rows) == expected);
+    }
+
+    SECTION("For each") {
+        vector<row_t> rows_copy = rows;
+
+        size_t visited = 0;
+        pipe(pipes::for_each([&](auto& row) {
+            get<0>(row) = 0;
+            ++visited;
+        }))(rows_copy);
+
+        REQUIRE(visited == rows.size());
+        for (const auto& row : rows_copy) {
+            REQUIRE(get<0>(row) == 0);
+        }
+    }
+
+    SECTION("Structure of arrays") {
+        fxx::soa_vector<tuple<int, string>> soa;
+        for (int i = 0; i < 3000; ++i) {
+            soa.emplace_back(i, to_string(i % 10));
+        }
+
+        const auto p = pipe(
+            pipes::filter([](const auto& row) { return get<1>(row) == "3"; }),
+            pipes::fold([](int acc, const auto& row) {
+                STATIC_REQUIRE(is_same_v<decltype(get<0>(row)), const int&>);
+                return acc + get<0>(row);
+            }, 0)
+        );
+
+        int expected = 0;
+        for (int i = 3; i < 3000; i += 10) {
+            expected += i;
+        }
+
+        REQUIRE(p(as_const(soa)) == expected);
+
+        pipe(pipes::for_each([](auto row) { get<0>(row) = 1; }))(soa);
+        REQUIRE(soa[2999] == make_tuple(1, "9"));
+    }
+
+    SECTION("Counting") {
+        vector<tuple<counted>> counted_rows(100, tuple<counted>(1));
+
+        counted::reset();
+        pipe(
+            pipes::filter([](const auto&) { return true; }),
+            pipes::for_each([](const auto&) {})
+        )(counted_rows);
+        REQUIRE(counted::copies == 0);
+        REQUIRE(counted::moves == 0);
+    }
+
+    SECTION("Constexpr") {
+        constexpr array<tuple<int, int>, 3> values{{{1, 2}, {3, 4}, {5, 6}}};
+        constexpr auto sum = pipe(
+            pipes::filter([](const auto& row) { return get<0>(row) != 3; }),
+            pipes::fold([](int acc, const auto& row) { return acc + get<1>(row); }, 0)
+        )(values);
+
+        STATIC_REQUIRE(sum == 8);
+    }
+}
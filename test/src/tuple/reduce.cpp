@@ -1,4 +1,5 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <functional>
@@ -6,7 +7,7 @@
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/reduce.h>
 
@@ -37,6 +38,14 @@ TEST_CASE("fxx::tuple::reduce", "[tuple]") {
             REQUIRE(r == -4);
         }
 
+        SECTION("Lvalues") {
+            const auto t = make_tuple(1, 2, 3);
+
+            auto r = reduce(std::minus{}, t);
+
+            REQUIRE(r == -4);
+        }
+
         SECTION("References") {
             int a = 1, b = 2, c = 3;
             auto t = forward_as_tuple(move(a), move(b), move(c));
@@ -52,4 +61,13 @@ TEST_CASE("fxx::tuple::reduce", "[tuple]") {
             REQUIRE(addressof(r) == &a);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int x, int y) noexcept { return x + y; };
+        auto throw_fn = [](int x, int y) { return x + y; };
+
+        static_assert(noexcept(reduce(nothrow_fn, declval<tuple<int, int>>())));
+        static_assert(!noexcept(reduce(throw_fn, declval<tuple<int, int>>())));
+        static_assert(!noexcept(reduce(nothrow_fn, declval<tuple<counted>>())));
+    }
+}
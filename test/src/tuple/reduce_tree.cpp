@@ -0,0 +1,80 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+#include <tuple/unsafe.h>
+
+#include <functional>
+// std::plus
+#include <string>
+// std::string
+#include <tuple>
+// std::(forward_as_tuple, make_tuple)
+#include <utility>
+// std::(declval, move)
+
+#include <fxx/tuple/reduce_tree.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+// Reduction function that records the shape of the reduction tree.
+static string bracket(const string& x, const string& y) {
+    return "(" + x + "+" + y + ")";
+}
+
+TEST_CASE("fxx::tuple::reduce_tree", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple(1);
+
+        auto r = reduce_tree(
+            std::plus{},
+            std::forward<decltype(t)>(t)
+        );
+
+        REQUIRE(r == 1);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(1, 2, 3, 4, 5);
+
+            auto r = reduce_tree(
+                std::plus{},
+                std::forward<decltype(t)>(t)
+            );
+
+            REQUIRE(r == 15);
+        }
+
+        SECTION("Shape") {
+            auto t4 = make_tuple(string("a"), string("b"), string("c"), string("d"));
+            auto t5 = make_tuple(string("a"), string("b"), string("c"), string("d"), string("e"));
+
+            REQUIRE(reduce_tree(bracket, t4) == "((a+b)+(c+d))");
+            REQUIRE(reduce_tree(bracket, t5) == "((a+b)+(c+(d+e)))");
+        }
+
+        SECTION("References") {
+            int a = 1, b = 2, c = 3;
+            auto t = forward_as_tuple(move(a), move(b), move(c));
+
+            auto&& r = reduce_tree(
+                [](auto&& x, auto&& y) -> decltype(x) { x += y; return forward<decltype(x)>(x); },
+                std::forward<decltype(t)>(t)
+            );
+
+            REQUIRE(a == 6);
+            REQUIRE(b == 5);
+            REQUIRE(c == 3);
+            REQUIRE(addressof(r) == &a);
+        }
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int x, int y) noexcept { return x + y; };
+        auto throw_fn = [](int x, int y) { return x + y; };
+
+        static_assert(noexcept(reduce_tree(nothrow_fn, declval<tuple<int, int, int>>())));
+        static_assert(!noexcept(reduce_tree(throw_fn, declval<tuple<int, int, int>>())));
+        static_assert(!noexcept(reduce_tree(nothrow_fn, declval<tuple<counted>>())));
+    }
+}
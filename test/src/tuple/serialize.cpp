@@ -0,0 +1,220 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+// std::equal
+#include <array>
+// std::array
+#include <cstddef>
+// std::byte
+#include <cstdint>
+// std::(int16_t, uint8_t, uint16_t, uint32_t, uint64_t)
+#include <cstring>
+// std::memcpy
+#include <string>
+// std::string
+#include <tuple>
+// std::(get, make_tuple, tie, tuple, tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::is_same_v
+#include <vector>
+// std::vector
+
+#include <fxx/tuple/serialize.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::serialize", "[tuple]") {
+    alignas(8) array<byte, 256> buffer{};
+
+    SECTION("Trivial case") {
+        STATIC_REQUIRE(serialized_size_v<tuple<>> == 0);
+
+        REQUIRE(serialize(make_tuple(), buffer) == 0);
+        REQUIRE(deserialize<tuple<>>(buffer) == make_tuple());
+        REQUIRE(deserialize<tuple<>>(span<const byte>{}) == make_tuple());
+    }
+
+    SECTION("Flat case") {
+        using record_t = tuple<std::uint8_t, std::uint32_t, double, std::int16_t>;
+        STATIC_REQUIRE(serialized_size_v<record_t> == 1 + 4 + 8 + 2);
+
+        const record_t a{1, 2, 3.5, -4};
+        REQUIRE(serialized_size_of(a) == serialized_size_v<record_t>);
+        REQUIRE(serialize(a, buffer) == serialized_size_v<record_t>);
+
+        // Elements are packed in logical order, without padding.
+        std::uint32_t y;
+        memcpy(&y, buffer.data() + 1, sizeof(y));
+        REQUIRE(static_cast<std::uint8_t>(buffer[0]) == 1);
+        REQUIRE(y == 2);
+
+        REQUIRE(deserialize<record_t>(buffer) == a);
+
+        SECTION("Truncated") {
+            REQUIRE(!serialize(a, span<byte>(buffer).first(serialized_size_v<record_t> - 1)));
+            REQUIRE(!deserialize<record_t>(span<const byte>(buffer).first(14)));
+        }
+
+        SECTION("References") {
+            std::uint8_t x = 1;
+            std::uint32_t y = 2;
+            double z = 3.5;
+            std::int16_t w = -4;
+
+            array<byte, 256> other{};
+            REQUIRE(serialize(tie(x, y, z, w), other) == serialized_size_v<record_t>);
+            REQUIRE(other == buffer);
+        }
+    }
+
+    SECTION("Nested case") {
+        using record_t = tuple<std::uint16_t, tuple<char, std::uint32_t>, char>;
+        STATIC_REQUIRE(serialized_size_v<record_t> == 2 + 1 + 4 + 1);
+
+        STATIC_REQUIRE(!fxx::tuple::detail::serial_tuple<record_t>::flat);
+
+        const record_t a{1, {'a', 2}, 'b'};
+
+        // Guard bytes after the exact serialized size must not be written.
+        array<byte, 12> exact;
+        exact.fill(byte{0xCC});
+        REQUIRE(serialize(a, span<byte>(exact).first(8)) == 8);
+        for (std::size_t i = 8; i < exact.size(); ++i) {
+            REQUIRE(exact[i] == byte{0xCC});
+        }
+
+        // Nested elements are concatenated in logical order.
+        const std::uint16_t x = 1;
+        const std::uint32_t y = 2;
+        array<byte, 8> expected;
+        memcpy(expected.data(), &x, 2);
+        expected[2] = byte{'a'};
+        memcpy(expected.data() + 3, &y, 4);
+        expected[7] = byte{'b'};
+        REQUIRE(equal(expected.begin(), expected.end(), exact.begin()));
+
+        REQUIRE(deserialize<record_t>(span<const byte>(exact).first(8)) == a);
+        REQUIRE(!view_serialized<record_t>(exact));
+
+        SECTION("Range") {
+            const vector<record_t> in{a, {3, {'c', 4}, 'd'}};
+            array<byte, 20> out;
+            out.fill(byte{0xCC});
+            REQUIRE(serialize_range(in, span<byte>(out).first(16)) == 16);
+            REQUIRE(out[16] == byte{0xCC});
+            REQUIRE(equal(expected.begin(), expected.end(), out.begin()));
+
+            vector<record_t> back(2);
+            REQUIRE(deserialize_range(span<const byte>(out).first(16), back) == 16);
+            REQUIRE(back == in);
+        }
+    }
+
+    SECTION("Variable case") {
+        using record_t = tuple<std::uint32_t, string, vector<double>, vector<string>>;
+        STATIC_REQUIRE(!fxx::tuple::detail::serial_tuple<record_t>::fixed);
+
+        const record_t a{7, "hello", {1.0, 2.0, 3.0}, {"a", "", "bc"}};
+        const std::size_t size = 4 + (8 + 5) + (8 + 3 * 8) + (8 + (8 + 1) + 8 + (8 + 2));
+        REQUIRE(serialized_size_of(a) == size);
+        REQUIRE(serialize(a, buffer) == size);
+        REQUIRE(deserialize<record_t>(span<const byte>(buffer).first(size)) == a);
+
+        SECTION("Homogeneous") {
+            using pair_t = tuple<string, string>;
+
+            const pair_t b{"x", "yz"};
+            REQUIRE(serialize(b, buffer) == 8 + 1 + 8 + 2);
+            REQUIRE(deserialize<pair_t>(buffer) == b);
+        }
+
+        SECTION("Empty") {
+            const record_t b{8, "", {}, {}};
+            REQUIRE(serialize(b, buffer) == 4 + 8 + 8 + 8);
+            REQUIRE(deserialize<record_t>(buffer) == b);
+        }
+
+        SECTION("Truncated") {
+            REQUIRE(!serialize(a, span<byte>(buffer).first(size - 1)));
+            for (std::size_t n = 0; n < size; ++n) {
+                REQUIRE(!deserialize<record_t>(span<const byte>(buffer).first(n)));
+            }
+        }
+
+        SECTION("Malformed") {
+            // Element count that does not fit into the buffer.
+            const std::uint64_t count = std::uint64_t{1} << 60;
+            memcpy(buffer.data() + 4, &count, sizeof(count));
+            REQUIRE(!deserialize<record_t>(buffer));
+        }
+    }
+
+    SECTION("Range") {
+        using record_t = tuple<std::uint32_t, std::uint16_t>;
+
+        const vector<record_t> in{{1, 2}, {3, 4}, {5, 6}};
+        REQUIRE(serialize_range(in, buffer) == 3 * 6);
+        REQUIRE(!serialize_range(in, span<byte>(buffer).first(3 * 6 - 1)));
+
+        vector<record_t> out(3);
+        REQUIRE(deserialize_range(buffer, out) == 3 * 6);
+        REQUIRE(out == in);
+
+        vector<record_t> more(4);
+        REQUIRE(!deserialize_range(span<const byte>(buffer).first(3 * 6), more));
+
+        SECTION("Variable") {
+            const vector<tuple<string>> strings{{"a"}, {"bc"}};
+            REQUIRE(serialize_range(strings, buffer) == (8 + 1) + (8 + 2));
+
+            vector<tuple<string>> result(2);
+            REQUIRE(deserialize_range(buffer, result) == (8 + 1) + (8 + 2));
+            REQUIRE(result == strings);
+        }
+    }
+
+    SECTION("View") {
+        using record_t = tuple<double, std::uint32_t, std::uint16_t, char>;
+        using view_t = views::serialized_view<record_t>;
+
+        STATIC_REQUIRE(tuple_size_v<view_t> == 4);
+        STATIC_REQUIRE(is_same_v<tuple_element_t<1, view_t>, const std::uint32_t>);
+        STATIC_REQUIRE(view_t::offset_at<2> == 12);
+
+        const record_t a{1.5, 2, 3, 'c'};
+        REQUIRE(serialize(a, buffer) == 15);
+
+        const auto view = view_serialized<record_t>(buffer);
+        REQUIRE(view);
+        REQUIRE(view->data() == buffer.data());
+        REQUIRE(views::get<0>(*view) == 1.5);
+        REQUIRE(views::get<1>(*view) == 2);
+
+        const auto& [w, x, y, z] = *view;
+        REQUIRE(static_cast<const void*>(&y) == buffer.data() + 12);
+        REQUIRE(w == 1.5);
+        REQUIRE(x == 2);
+        REQUIRE(y == 3);
+        REQUIRE(z == 'c');
+
+        SECTION("Rejected") {
+            // Misaligned buffer.
+            REQUIRE(!view_serialized<record_t>(span<const byte>(buffer).subspan(1)));
+            // Truncated buffer.
+            REQUIRE(!view_serialized<record_t>(span<const byte>(buffer).first(14)));
+            // Misaligned elements.
+            REQUIRE(!view_serialized<tuple<char, std::uint32_t>>(buffer));
+            // Variable elements.
+            REQUIRE(!view_serialized<tuple<string>>(buffer));
+        }
+    }
+
+    SECTION("Noexcept") {
+        const tuple<int, string> a{1, "a"};
+
+        STATIC_REQUIRE(noexcept(serialize(a, buffer)));
+        STATIC_REQUIRE(noexcept(serialized_size_of(a)));
+        STATIC_REQUIRE(noexcept(view_serialized<tuple<int>>(buffer)));
+    }
+}
@@ -1,10 +1,11 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/skip.h>
 
@@ -45,4 +46,9 @@ TEST_CASE("fxx::tuple::skip", "[tuple]") {
             REQUIRE(addressof(get<1>(std::forward<decltype(t_skip1)>(t_skip1))) == &c);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(skip<1>(declval<tuple<counted, int>>())));
+        static_assert(!noexcept(skip<0>(declval<tuple<counted, int>>())));
+    }
+}
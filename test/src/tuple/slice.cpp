@@ -1,10 +1,11 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/slice.h>
 
@@ -40,4 +41,35 @@ TEST_CASE("fxx::tuple::slice", "[tuple]") {
             REQUIRE(addressof(get<0>(std::forward<decltype(t_slice_1_1)>(t_slice_1_1))) == &b);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Counting") {
+        SECTION("Copies") {
+            auto t = make_tuple(counted{1}, counted{2}, counted{3});
+            counted::reset();
+
+            auto t_slice_1_2 = slice<1, 2>(t);
+
+            REQUIRE(get<0>(t_slice_1_2).value == 2);
+            REQUIRE(get<1>(t_slice_1_2).value == 3);
+            REQUIRE(counted::copies == 2);
+            REQUIRE(counted::moves == 0);
+        }
+
+        SECTION("Moves") {
+            auto t = make_tuple(counted{1}, counted{2}, counted{3});
+            counted::reset();
+
+            auto t_slice_1_2 = slice<1, 2>(move(t));
+
+            REQUIRE(get<0>(t_slice_1_2).value == 2);
+            REQUIRE(get<1>(t_slice_1_2).value == 3);
+            REQUIRE(counted::copies == 0);
+            REQUIRE(counted::moves == 2);
+        }
+    }
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(slice<1, 1>(declval<tuple<counted, int>>())));
+        static_assert(!noexcept(slice<0, 1>(declval<tuple<counted, int>>())));
+    }
+}
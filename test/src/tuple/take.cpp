@@ -1,10 +1,11 @@
 #include <catch2/catch.hpp>
+#include <tuple/counted.h>
 #include <tuple/unsafe.h>
 
 #include <tuple>
 // std::(forward_as_tuple, get, make_tuple)
 #include <utility>
-// std::move
+// std::(declval, move)
 
 #include <fxx/tuple/take.h>
 
@@ -42,4 +43,9 @@ TEST_CASE("fxx::tuple::take", "[tuple]") {
             REQUIRE(addressof(get<1>(std::forward<decltype(t_take2)>(t_take2))) == &b);
         }
     }
-}
\ No newline at end of file
+
+    SECTION("Noexcept") {
+        static_assert(noexcept(take<1>(declval<tuple<int, counted>>())));
+        static_assert(!noexcept(take<2>(declval<tuple<int, counted>>())));
+    }
+}
@@ -0,0 +1,123 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+
+#include <array>
+// std::array
+#include <string>
+// std::string
+#include <tuple>
+// std::(forward_as_tuple, get, make_tuple, tie, tuple)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::move
+#include <vector>
+// std::vector
+
+#include <fxx/tuple/transpose.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::transpose", "[tuple]") {
+    SECTION("Trivial case") {
+        vector<tuple<int, string>> rows;
+
+        auto columns = transpose(rows);
+
+        static_assert(is_same_v<decltype(columns), tuple<vector<int>, vector<string>>>);
+        REQUIRE(get<0>(columns).empty());
+        REQUIRE(get<1>(columns).empty());
+
+        auto empty = transpose(tuple<>{});
+
+        static_assert(is_same_v<decltype(empty), vector<tuple<>>>);
+        REQUIRE(empty.empty());
+    }
+
+    SECTION("Regular case") {
+        SECTION("Rows to columns") {
+            const array<tuple<int, double, string>, 3> rows{{
+                {1, 1.5, "a"},
+                {2, 2.5, "b"},
+                {3, 3.5, "c"}
+            }};
+
+            auto columns = transpose(rows);
+
+            static_assert(is_same_v<
+                decltype(columns),
+                tuple<vector<int>, vector<double>, vector<string>>
+            >);
+            REQUIRE(get<0>(columns) == vector<int>{1, 2, 3});
+            REQUIRE(get<1>(columns) == vector<double>{1.5, 2.5, 3.5});
+            REQUIRE(get<2>(columns) == vector<string>{"a", "b", "c"});
+            REQUIRE(get<0>(columns).capacity() == 3);
+        }
+
+        SECTION("Columns to rows") {
+            auto columns = make_tuple(vector<int>{1, 2, 3}, vector<string>{"a", "b"});
+
+            auto rows = transpose(columns);
+
+            static_assert(is_same_v<decltype(rows), vector<tuple<int, string>>>);
+            REQUIRE(rows.size() == 2);
+            REQUIRE(rows[0] == make_tuple(1, string("a")));
+            REQUIRE(rows[1] == make_tuple(2, string("b")));
+        }
+
+        SECTION("Round trip") {
+            const vector<tuple<int, string>> rows{{1, "a"}, {2, "b"}};
+
+            REQUIRE(transpose(transpose(rows)) == rows);
+        }
+    }
+
+    SECTION("Counting") {
+        SECTION("Copies") {
+            vector<tuple<int, counted>> rows{{1, counted{1}}, {2, counted{2}}};
+            counted::reset();
+
+            auto columns = transpose(rows);
+
+            REQUIRE(get<1>(columns)[1].value == 2);
+            REQUIRE(counted::copies == 2);
+            REQUIRE(counted::moves == 0);
+        }
+
+        SECTION("Moves") {
+            vector<tuple<int, counted>> rows{{1, counted{1}}, {2, counted{2}}};
+            counted::reset();
+
+            auto columns = transpose(std::move(rows));
+            REQUIRE(counted::copies == 0);
+            REQUIRE(counted::moves == 2);
+
+            auto back = transpose(std::move(columns));
+            REQUIRE(get<1>(back[0]).value == 1);
+            REQUIRE(counted::copies == 0);
+            REQUIRE(counted::moves == 4);
+        }
+
+        SECTION("References") {
+            vector<int> a{1, 2};
+            vector<counted> b{counted{1}, counted{2}};
+            vector<counted> c{counted{3}, counted{4}};
+            counted::reset();
+
+            // Referenced columns are copied, even from an rvalue tuple.
+            auto rows = transpose(tie(a, b));
+            REQUIRE(get<1>(rows[1]).value == 2);
+            REQUIRE(counted::copies == 2);
+            REQUIRE(counted::moves == 0);
+
+            // Only the columns that are forwarded as rvalues are moved from.
+            counted::reset();
+            auto more = transpose(forward_as_tuple(b, std::move(c)));
+            REQUIRE(get<0>(more[0]).value == 1);
+            REQUIRE(get<1>(more[1]).value == 4);
+            REQUIRE(counted::copies == 2);
+            REQUIRE(counted::moves == 2);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch.hpp>
+#include <tuple/counted.h>
+#include <tuple/unsafe.h>
+
+#include <string>
+// std::string
+#include <tuple>
+// std::(get, make_tuple, tuple, tuple_element_t, tuple_size_v)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::as_const
+
+#include <fxx/tuple/map.h>
+#include <fxx/tuple/views.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::views", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple(1, 2);
+
+        auto v = views::take<0>(t);
+
+        static_assert(std::tuple_size_v<decltype(v)> == 0);
+        static_assert(std::tuple_size_v<decltype(views::materialize(v))> == 0);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+
+            auto v = views::skip<2>(views::take<8>(views::flip(t)));
+
+            static_assert(is_same_v<decltype(v), views::index_view<decltype(t), 7, 6, 5, 4, 3, 2>>);
+            static_assert(std::tuple_size_v<decltype(v)> == 6);
+            static_assert(is_same_v<std::tuple_element_t<0, decltype(v)>, int>);
+            REQUIRE(views::get<0>(v) == 7);
+            REQUIRE(views::get<5>(v) == 2);
+            REQUIRE(views::materialize(v) == make_tuple(7, 6, 5, 4, 3, 2));
+
+            auto [a, b] = views::pick<1, 3>(views::slice<4, 4>(t));
+            REQUIRE(a == 5);
+            REQUIRE(b == 7);
+        }
+
+        SECTION("References") {
+            auto t = make_tuple(1, string("a"), 2.5);
+
+            auto v = views::pick<1, 0>(t);
+            get<1>(v) = 10;
+
+            REQUIRE(get<0>(t) == 10);
+            REQUIRE(addressof(get<0>(v)) == &get<1>(t));
+
+            auto cv = views::flip(as_const(t));
+            static_assert(is_same_v<std::tuple_element_t<0, decltype(cv)>, const double>);
+            static_assert(is_same_v<decltype(get<0>(cv)), const double&>);
+            REQUIRE(addressof(get<2>(cv)) == &get<0>(t));
+
+            auto tied = views::tie(v);
+            static_assert(is_same_v<decltype(tied), tuple<string&, int&>>);
+            REQUIRE(map([](auto& x) -> auto& { return x; }, tied) == make_tuple(string("a"), 10));
+        }
+    }
+
+    SECTION("Counting") {
+        auto t = make_tuple(counted{1}, counted{2}, counted{3});
+        counted::reset();
+
+        auto v = views::slice<1, 2>(views::flip(views::pick<0, 1, 2>(t)));
+        REQUIRE(counted::copies == 0);
+        REQUIRE(counted::moves == 0);
+
+        auto m = views::materialize(v);
+        REQUIRE(get<0>(m).value == 2);
+        REQUIRE(get<1>(m).value == 1);
+        REQUIRE(counted::copies == 2);
+        REQUIRE(counted::moves == 0);
+    }
+
+    SECTION("Noexcept") {
+        auto t = make_tuple(counted{1}, 2);
+
+        static_assert(noexcept(views::flip(t)));
+        static_assert(noexcept(views::tie(views::flip(t))));
+        static_assert(!noexcept(views::materialize(views::flip(t))));
+    }
+}
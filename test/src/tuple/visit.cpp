@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+#include <tuple/unsafe.h>
+
+#include <string>
+// std::string
+#include <tuple>
+// std::(forward_as_tuple, get, make_tuple, tuple)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::(declval, forward, move)
+
+#include <fxx/tuple/visit.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+TEST_CASE("fxx::tuple::visit_at", "[tuple]") {
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto t = make_tuple(1, 2.5, string("abc"));
+            auto describe = [](auto&& x) -> string {
+                if constexpr (std::is_same_v<decay_t<decltype(x)>, string>) {
+                    return x;
+                } else {
+                    return to_string(static_cast<int>(x * 2));
+                }
+            };
+
+            REQUIRE(visit_at(0, describe, t) == "2");
+            REQUIRE(visit_at(1, describe, t) == "5");
+            REQUIRE(visit_at(2, describe, t) == "abc");
+        }
+
+        SECTION("References") {
+            int a = 1, b = 2, c = 3;
+            auto t = forward_as_tuple(move(a), move(b), move(c));
+
+            auto&& r = visit_at(
+                1,
+                [](auto&& x) -> int& { x *= 2; return x; },
+                std::forward<decltype(t)>(t)
+            );
+
+            REQUIRE(a == 1);
+            REQUIRE(b == 4);
+            REQUIRE(c == 3);
+            REQUIRE(addressof(r) == &b);
+        }
+
+        SECTION("Constexpr") {
+            static_assert(visit_at(2, [](int x) { return x * 2; }, make_tuple(1, 2, 3)) == 6);
+        }
+    }
+
+    SECTION("Noexcept") {
+        auto nothrow_fn = [](int x) noexcept { return x; };
+        auto throw_fn = [](int x) { return x; };
+
+        static_assert(noexcept(visit_at(0, nothrow_fn, declval<tuple<int, int>>())));
+        static_assert(!noexcept(visit_at(0, throw_fn, declval<tuple<int, int>>())));
+    }
+}
+
+TEST_CASE("fxx::tuple::first_visit", "[tuple]") {
+    SECTION("Trivial case") {
+        auto t = make_tuple();
+
+        auto idx = first_visit(
+            [](auto&&) { return true; },
+            [](auto&&) {},
+            std::forward<decltype(t)>(t)
+        );
+
+        REQUIRE(!idx);
+    }
+
+    SECTION("Regular case") {
+        auto t = make_tuple(1, 2, 3);
+        int visited = 0;
+
+        auto idx = first_visit(
+            [](int x) { return x > 1; },
+            [&visited](int x) { visited = x; },
+            t
+        );
+
+        REQUIRE(idx);
+        REQUIRE(idx.value() == 1);
+        REQUIRE(visited == 2);
+    }
+
+    SECTION("Rvalue") {
+        const string long_string = "a string that does not fit into the small buffer";
+        auto t = make_tuple(string("a"), long_string);
+        string visited;
+
+        // A by-value predicate must not move the element out before the visitor sees it.
+        auto idx = first_visit(
+            [](string x) { return x.size() > 1; },
+            [&visited](string&& x) { visited = std::move(x); },
+            std::move(t)
+        );
+
+        REQUIRE(idx);
+        REQUIRE(idx.value() == 1);
+        REQUIRE(visited == long_string);
+    }
+}
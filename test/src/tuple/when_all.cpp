@@ -0,0 +1,151 @@
+#include <catch2/catch.hpp>
+
+#include <chrono>
+// std::chrono::seconds
+#include <exception>
+// std::(make_exception_ptr, terminate)
+#include <future>
+// std::(async, future, future_status, launch, promise, shared_future)
+#include <stdexcept>
+// std::runtime_error
+#include <string>
+// std::string
+#include <thread>
+// std::this_thread::get_id
+#include <tuple>
+// std::(get, make_tuple, tuple)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::move
+#include <variant>
+// std::monostate
+
+#include <fxx/tuple/when_all.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+#ifdef FXX_TUPLE_WHEN_ALL_CORO
+#include <coroutine>
+// std::suspend_never
+
+namespace {
+
+// Coroutine that starts eagerly and destroys itself when it completes.
+struct detached_task {
+    struct promise_type {
+        detached_task get_return_object() noexcept { return {}; }
+        suspend_never initial_suspend() noexcept { return {}; }
+        suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+using join_result_t = tuple<tuple<int, monostate>, thread::id>;
+
+// Join the futures, and publish the results and the resuming thread.
+detached_task join(tuple<future<int>, shared_future<void>> futures, promise<join_result_t>& out) {
+    auto r = co_await co_when_all(move(futures));
+    out.set_value({move(r), this_thread::get_id()});
+}
+
+} // namespace
+#endif
+
+TEST_CASE("fxx::tuple::when_all", "[tuple]") {
+    SECTION("Trivial case") {
+        auto r = when_all(make_tuple());
+
+        static_assert(std::tuple_size_v<decltype(r)> == 0);
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            auto futures = make_tuple(
+                async(launch::async, [] { return 1; }),
+                async(launch::async, [] { return string("a"); }),
+                async(launch::async, [] {})
+            );
+
+            auto r = when_all(move(futures));
+
+            static_assert(is_same_v<decltype(r), tuple<int, string, monostate>>);
+            REQUIRE(get<0>(r) == 1);
+            REQUIRE(get<1>(r) == "a");
+        }
+
+        SECTION("References") {
+            int a = 1;
+            promise<int&> p;
+            auto futures = make_tuple(p.get_future(), async(launch::deferred, [] { return 2; }));
+            p.set_value(a);
+
+            auto r = when_all(futures);
+
+            static_assert(is_same_v<decltype(r), tuple<int&, int>>);
+            REQUIRE(&get<0>(r) == &a);
+            REQUIRE(get<1>(r) == 2);
+            REQUIRE(!get<0>(futures).valid());
+        }
+
+        SECTION("Shared") {
+            promise<string> p;
+            auto futures = make_tuple(p.get_future().share());
+            p.set_value("a");
+
+            auto r = when_all(futures);
+
+            static_assert(is_same_v<decltype(r), tuple<string>>);
+            REQUIRE(get<0>(r) == "a");
+            REQUIRE(get<0>(futures).valid());
+        }
+    }
+
+    SECTION("Exceptions") {
+        promise<int> p0, p1, p2;
+        auto futures = make_tuple(p0.get_future(), p1.get_future(), p2.get_future());
+        p2.set_exception(make_exception_ptr(runtime_error("2")));
+        p1.set_exception(make_exception_ptr(runtime_error("1")));
+        p0.set_value(0);
+
+        REQUIRE_THROWS_WITH(when_all(move(futures)), "1");
+    }
+
+#ifdef FXX_TUPLE_WHEN_ALL_CORO
+    SECTION("Coroutines") {
+        promise<int> p0;
+        promise<void> p1;
+        const auto shared = p1.get_future().share();
+        promise<join_result_t> out;
+        auto result = out.get_future();
+
+        SECTION("Ready") {
+            p0.set_value(1);
+            p1.set_value();
+
+            // Ready futures complete without suspending.
+            join(make_tuple(p0.get_future(), shared), out);
+            REQUIRE(result.wait_for(chrono::seconds(0)) == future_status::ready);
+
+            const auto [r, id] = result.get();
+            REQUIRE(get<0>(r) == 1);
+            REQUIRE(id == this_thread::get_id());
+        }
+
+        SECTION("Pending") {
+            p1.set_value();
+
+            join(make_tuple(p0.get_future(), shared), out);
+            REQUIRE(result.wait_for(chrono::seconds(0)) == future_status::timeout);
+
+            // Resumed on the waiting thread.
+            p0.set_value(2);
+            const auto [r, id] = result.get();
+            REQUIRE(get<0>(r) == 2);
+            REQUIRE(id != this_thread::get_id());
+        }
+    }
+#endif
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch.hpp>
+#include <tuple/unsafe.h>
+
+#include <array>
+// std::array
+#include <functional>
+// std::plus
+#include <string>
+// std::string
+#include <tuple>
+// std::(get, make_tuple, tuple)
+#include <type_traits>
+// std::is_same_v
+#include <utility>
+// std::as_const
+#include <vector>
+// std::vector
+
+#include <fxx/tuple/fold.h>
+#include <fxx/tuple/map.h>
+#include <fxx/tuple/pick.h>
+#include <fxx/tuple/zip.h>
+
+using namespace std;
+using namespace fxx::tuple;
+
+namespace {
+
+// Type without a default constructor.
+struct boxed {
+    explicit boxed(int value) : value(value) {}
+
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("fxx::tuple::zip", "[tuple]") {
+    SECTION("Trivial case") {
+        vector<int> a;
+        vector<double> b{1.0};
+
+        auto z = zip(a, b);
+
+        REQUIRE(z.empty());
+        REQUIRE(z.begin() == z.end());
+    }
+
+    SECTION("Regular case") {
+        SECTION("Values") {
+            vector<int> a{1, 2, 3};
+            const array<double, 4> b{0.5, 1.5, 2.5, 3.5};
+
+            auto z = zip(a, b);
+
+            static_assert(is_same_v<decltype(z)::value_type, tuple<int, double>>);
+            REQUIRE(z.size() == 3);
+            REQUIRE(z[2] == make_tuple(3, 2.5));
+        }
+
+        SECTION("References") {
+            vector<int> a{1, 2, 3};
+            vector<string> b{"a", "b", "c"};
+
+            for (auto row : zip(a, b)) {
+                static_assert(is_same_v<decltype(row), tuple<int&, string&>>);
+                get<0>(row) *= 2;
+                get<1>(row) += "!";
+            }
+
+            REQUIRE(a == vector<int>{2, 4, 6});
+            REQUIRE(b == vector<string>{"a!", "b!", "c!"});
+            REQUIRE(addressof(get<1>(zip(a, b)[1])) == &b[1]);
+        }
+
+        SECTION("Functors") {
+            vector<int> a{1, 2, 3};
+            vector<int> b{10, 20, 30};
+            auto z = zip(a, b);
+
+            REQUIRE(fold(std::plus{}, 0, z[1]) == 22);
+            REQUIRE(map([](int x) { return x + 1; }, z[0]) == make_tuple(2, 11));
+            REQUIRE(addressof(get<0>(pick<1>(z[2]))) == &b[2]);
+        }
+    }
+
+    SECTION("Transform") {
+        vector<float> a{1.0f, 2.0f, 3.0f};
+        vector<float> b{4.0f, 5.0f, 6.0f, 7.0f};
+
+        auto r = zip_transform([](float x, float y) { return x * y; }, a, b);
+
+        static_assert(is_same_v<decltype(r), vector<float>>);
+        REQUIRE(r == vector<float>{4.0f, 10.0f, 18.0f});
+
+        auto boxes = zip_transform([](int x) { return boxed{x}; }, as_const(a));
+
+        REQUIRE(boxes.size() == 3);
+        REQUIRE(boxes[2].value == 3);
+
+        auto smaller = zip_transform([](float x, float y) { return 2.0f * x < y; }, a, b);
+
+        static_assert(is_same_v<decltype(smaller), vector<bool>>);
+        REQUIRE(smaller == vector<bool>{true, true, false});
+    }
+}